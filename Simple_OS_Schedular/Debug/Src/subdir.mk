@@ -5,7 +5,27 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../Src/GPIO_Program.c \
+../Src/OS_ActiveObject.c \
+../Src/OS_Budget.c \
+../Src/OS_Chain.c \
+../Src/OS_Cyclic.c \
+../Src/OS_Histogram.c \
+../Src/OS_Idle.c \
+../Src/OS_Instance.c \
+../Src/OS_Latency.c \
+../Src/OS_Load.c \
+../Src/OS_Log.c \
+../Src/OS_Overload.c \
+../Src/OS_Partition.c \
+../Src/OS_Profiler.c \
 ../Src/OS_Schedular.c \
+../Src/OS_SeqLock.c \
+../Src/OS_Server.c \
+../Src/OS_Srp.c \
+../Src/OS_Stack.c \
+../Src/OS_StaticSchedular.c \
+../Src/OS_Topic.c \
+../Src/OS_Trace.c \
 ../Src/RCC_Program.c \
 ../Src/SERVICE_FUNCTIONS.c \
 ../Src/STK_Program.c \
@@ -13,7 +33,27 @@ C_SRCS += \
 
 OBJS += \
 ./Src/GPIO_Program.o \
+./Src/OS_ActiveObject.o \
+./Src/OS_Budget.o \
+./Src/OS_Chain.o \
+./Src/OS_Cyclic.o \
+./Src/OS_Histogram.o \
+./Src/OS_Idle.o \
+./Src/OS_Instance.o \
+./Src/OS_Latency.o \
+./Src/OS_Load.o \
+./Src/OS_Log.o \
+./Src/OS_Overload.o \
+./Src/OS_Partition.o \
+./Src/OS_Profiler.o \
 ./Src/OS_Schedular.o \
+./Src/OS_SeqLock.o \
+./Src/OS_Server.o \
+./Src/OS_Srp.o \
+./Src/OS_Stack.o \
+./Src/OS_StaticSchedular.o \
+./Src/OS_Topic.o \
+./Src/OS_Trace.o \
 ./Src/RCC_Program.o \
 ./Src/SERVICE_FUNCTIONS.o \
 ./Src/STK_Program.o \
@@ -21,7 +61,27 @@ OBJS += \
 
 C_DEPS += \
 ./Src/GPIO_Program.d \
+./Src/OS_ActiveObject.d \
+./Src/OS_Budget.d \
+./Src/OS_Chain.d \
+./Src/OS_Cyclic.d \
+./Src/OS_Histogram.d \
+./Src/OS_Idle.d \
+./Src/OS_Instance.d \
+./Src/OS_Latency.d \
+./Src/OS_Load.d \
+./Src/OS_Log.d \
+./Src/OS_Overload.d \
+./Src/OS_Partition.d \
+./Src/OS_Profiler.d \
 ./Src/OS_Schedular.d \
+./Src/OS_SeqLock.d \
+./Src/OS_Server.d \
+./Src/OS_Srp.d \
+./Src/OS_Stack.d \
+./Src/OS_StaticSchedular.d \
+./Src/OS_Topic.d \
+./Src/OS_Trace.d \
 ./Src/RCC_Program.d \
 ./Src/SERVICE_FUNCTIONS.d \
 ./Src/STK_Program.d \
@@ -31,8 +91,48 @@ C_DEPS += \
 # Each subdirectory must supply rules for building sources it contributes
 Src/GPIO_Program.o: ../Src/GPIO_Program.c
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/GPIO_Program.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_ActiveObject.o: ../Src/OS_ActiveObject.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_ActiveObject.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Budget.o: ../Src/OS_Budget.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Budget.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Chain.o: ../Src/OS_Chain.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Chain.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Cyclic.o: ../Src/OS_Cyclic.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Cyclic.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Histogram.o: ../Src/OS_Histogram.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Histogram.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Idle.o: ../Src/OS_Idle.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Idle.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Instance.o: ../Src/OS_Instance.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Instance.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Latency.o: ../Src/OS_Latency.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Latency.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Load.o: ../Src/OS_Load.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Load.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Log.o: ../Src/OS_Log.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Log.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Overload.o: ../Src/OS_Overload.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Overload.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Partition.o: ../Src/OS_Partition.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Partition.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Profiler.o: ../Src/OS_Profiler.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Profiler.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
 Src/OS_Schedular.o: ../Src/OS_Schedular.c
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Schedular.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_SeqLock.o: ../Src/OS_SeqLock.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_SeqLock.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Server.o: ../Src/OS_Server.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Server.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Srp.o: ../Src/OS_Srp.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Srp.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Stack.o: ../Src/OS_Stack.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Stack.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_StaticSchedular.o: ../Src/OS_StaticSchedular.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_StaticSchedular.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Topic.o: ../Src/OS_Topic.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Topic.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+Src/OS_Trace.o: ../Src/OS_Trace.c
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/OS_Trace.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
 Src/RCC_Program.o: ../Src/RCC_Program.c
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DSTM32 -DSTM32F1 -DSTM32F103C8Tx -DDEBUG -c -I../Inc -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"Src/RCC_Program.d" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
 Src/SERVICE_FUNCTIONS.o: ../Src/SERVICE_FUNCTIONS.c
@@ -0,0 +1,137 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Active Object             */
+/*     			    Description	 : OS Active Object Header File */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_ACTIVEOBJECT_H_
+#define OS_ACTIVEOBJECT_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : An active object is a state machine with a private event queue, mapped to one priority       */
+/*            level (task) of the schedular. Posting an event queues it in O(1) and activates the task,    */
+/*            so the object only runs when it has something to do instead of polling every period.         */
+/*                                                                                                         */
+/*  Note(2) : Each run of the task takes one event and runs it to completion through the current state     */
+/*            handler, then lets the dispatcher pick the highest priority ready task again if events are   */
+/*            still queued. All objects share the one stack of the dispatcher.                             */
+/*                                                                                                         */
+/*  Note(3) : A state handler requests a transition through OS_ActiveObjectTransition, the transition is   */
+/*            taken once the handler returns: OS_AO_SIG_EXIT is sent to the old state, then                */
+/*            OS_AO_SIG_ENTRY is sent to the new one.                                                      */
+/*                                                                                                         */
+/*  Note(4) : An application object embeds OS_ActiveObject_t as its first member so that state handlers    */
+/*            can cast the passed object pointer back to reach its extended state.                         */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint8_t Signal;								/* What happened (OS_AO_SIG_xxx or an application signal) */
+	uint32_t Parameter;							/* Optional data coming with the signal */
+}OS_Event_t;
+
+typedef struct OS_ActiveObject OS_ActiveObject_t;
+
+/* A state is the function handling the events received while the object is in it */
+typedef void (*OS_StateHandler_t)(OS_ActiveObject_t* Copy_pMe, const OS_Event_t* Copy_pEvent);
+
+struct OS_ActiveObject
+{
+	OS_StateHandler_t pState;					/* Current state of the object */
+	OS_StateHandler_t pTargetState;				/* State requested by the running handler (NULL if none) */
+	OS_Event_t QueueArr[OS_AO_QUEUE_SIZE];		/* Private event queue (FIFO) */
+	volatile uint8_t QueueHead;					/* Index of the oldest queued event */
+	volatile uint8_t QueueCount;				/* Number of queued events */
+	uint8_t Priority;							/* Priority of the task running the object */
+	uint32_t EventsLost;						/* Number of events refused because the queue was full */
+};
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Reserved signals, application signals start from OS_AO_SIG_USER */
+#define OS_AO_SIG_ENTRY					0U
+#define OS_AO_SIG_EXIT					1U
+#define OS_AO_SIG_USER					2U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ActiveObjectStart                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task running the object                 */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 OS_StateHandler_t Copy_pInitialState                           */
+/*                 Brief: State the object starts in                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_ActiveObject_t* Copy_pMe                                    */
+/*                 Brief: Object to be started                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates the task of the object, empties its queue and enters   */
+/*                 its initial state, must be called before OS_Init like          */
+/*                 TASKS_CREATION (one of the NUM_OF_CREATED_TASKS descriptors)   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ActiveObjectStart(OS_ActiveObject_t* Copy_pMe, uint8_t Copy_Priority, OS_StateHandler_t Copy_pInitialState);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ActiveObjectPost                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Signal                                            */
+/*                 Brief: Signal of the event                                     */
+/*                 Range: (OS_AO_SIG_USER --> 255)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Parameter                                        */
+/*                 Brief: Data coming with the signal                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_ActiveObject_t* Copy_pMe                                    */
+/*                 Brief: Object receiving the event                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (BUSY_FUNC if the queue is full)                */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Queues an event to an object and activates its task, O(1) and  */
+/*                 safe to be called from tasks and ISRs                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ActiveObjectPost(OS_ActiveObject_t* Copy_pMe, uint8_t Copy_Signal, uint32_t Copy_Parameter);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ActiveObjectTransition                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : OS_StateHandler_t Copy_pNewState                               */
+/*                 Brief: State to move to                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_ActiveObject_t* Copy_pMe                                    */
+/*                 Brief: Object whose handler is running                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Requests a transition, to be called from a state handler only, */
+/*                 the transition is taken once the handler returns               */
+/*--------------------------------------------------------------------------------*/
+void OS_ActiveObjectTransition(OS_ActiveObject_t* Copy_pMe, OS_StateHandler_t Copy_pNewState);
+
+#endif /* OS_ACTIVEOBJECT_H_ */
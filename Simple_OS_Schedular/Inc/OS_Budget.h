@@ -0,0 +1,168 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Budget                    */
+/*     			    Description	 : OS Budget Header File        */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_BUDGET_H_
+#define OS_BUDGET_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_BUDGET_ENFORCEMENT enabled every task can be given a CPU budget in microseconds.     */
+/*            TIM2 runs free at 1 MHz and its channel 1 compare is armed with the budget of a task each    */
+/*            time it is dispatched, the compare interrupt (above every task level) fires if the task is   */
+/*            still running once its budget is spent.                                                      */
+/*                                                                                                         */
+/*  Note(2) : Time spent in a task preempting another one (OS_PREEMPTIVE_SRP) is not charged to the        */
+/*            preempted task, its compare is pushed back by that time when it resumes.                     */
+/*                                                                                                         */
+/*  Note(3) : An exceeded budget is counted and reported to the overrun callback, then OS_BUDGET_ACTION    */
+/*            applies: OS_BUDGET_NOTIFY does nothing more, OS_BUDGET_SUSPEND suspends the task once it     */
+/*            returns and OS_BUDGET_DEMOTE (OS_PREEMPTIVE_SRP only) drops the task to the lowest task      */
+/*            level until it returns, so every other task preempts it meanwhile.                           */
+/*                                                                                                         */
+/*  Note(4) : The overrun callback runs in the compare interrupt, above every task level, keep it short.   */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetInit                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Starts the budget timer and enables its interrupt, called by   */
+/*                 OS_Init when OS_BUDGET_ENFORCEMENT is enabled                  */
+/*--------------------------------------------------------------------------------*/
+void OS_BudgetInit(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetBudget                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint16_t Copy_BudgetUs                                         */
+/*                 Brief: CPU budget of every run of the task in microseconds     */
+/*                 Range: (0 --> 32767) where 0 means no budget                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the CPU budget of a task, applied from its next run       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetBudget(uint8_t Copy_Priority, uint16_t Copy_BudgetUs);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskGetBudget                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint16_t* Copy_pBudgetUs                                       */
+/*                 Brief: CPU budget of the task in microseconds (0 for none)     */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the CPU budget of a task                                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskGetBudget(uint8_t Copy_Priority, uint16_t* Copy_pBudgetUs);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetSetCallback                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void (*Copy_pCallback)(uint8_t)                                */
+/*                 Brief: Function called with the priority of every task that    */
+/*                        exceeds its budget (may be NULL)                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the budget overrun callback                               */
+/*--------------------------------------------------------------------------------*/
+void OS_BudgetSetCallback(void (*Copy_pCallback)(uint8_t));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetGetOverruns                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pOverrunCount                                   */
+/*                 Brief: Number of runs of the task that exceeded its budget     */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the budget overrun count of a task                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_BudgetGetOverruns(uint8_t Copy_Priority, uint32_t* Copy_pOverrunCount);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetStart                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task being dispatched                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint16_t                                                       */
+/*                 Brief: Budget timer count at dispatch, to be passed back to    */
+/*                        OS_BudgetStop                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Arms the budget compare of a task, called by OS_ExecuteTask    */
+/*                 right before the task function                                 */
+/*--------------------------------------------------------------------------------*/
+uint16_t OS_BudgetStart(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetStop                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task that returned                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_PreviousTask                                      */
+/*                 Brief: Task preempted by it (OS_NO_TASK if none)               */
+/*                 -------------------------------------------------------------- */
+/*                 uint16_t Copy_StartCount                                       */
+/*                 Brief: Count returned by the matching OS_BudgetStart           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Applies the overrun action of the returned task and re-arms    */
+/*                 the compare of the preempted task, called by OS_ExecuteTask    */
+/*                 right after the task function                                  */
+/*--------------------------------------------------------------------------------*/
+void OS_BudgetStop(uint8_t Copy_Priority, uint8_t Copy_PreviousTask, uint16_t Copy_StartCount);
+
+#endif /* OS_BUDGET_H_ */
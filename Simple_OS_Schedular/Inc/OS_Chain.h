@@ -0,0 +1,150 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Chain                     */
+/*     			    Description	 : OS Chain Header File         */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_CHAIN_H_
+#define OS_CHAIN_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : A chain is a pipeline of tasks (e.g. sense --> compute --> actuate). Only its head stage is  */
+/*            periodic, every next stage is released in the same schedular pass as soon as the stage       */
+/*            before it completes, so a chain adds no period of latency between its stages.                */
+/*                                                                                                         */
+/*  Note(2) : A stage hands its output over to the next stage through OS_ChainHandOver, and the next       */
+/*            stage gets it through OS_ChainReceive. Both find the chain from the running task, so stage   */
+/*            functions need no chain id. A stage shares one buffer with its neighbours, so it has to      */
+/*            receive its input before handing its own output over.                                        */
+/*                                                                                                         */
+/*  Note(3) : End to end latency of a chain is measured in CPU cycles from the start of its head stage to  */
+/*            the completion of its last stage.                                                            */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t Completions;						/* Number of times the last stage of the chain completed */
+	uint32_t LastLatency;						/* End to end latency of the last run in CPU cycles */
+	uint32_t MaxLatency;						/* Worst end to end latency seen in CPU cycles */
+}OS_ChainStats_t;
+
+typedef struct
+{
+	uint8_t NumOfStages;						/* Number of stages of the chain (0 if chain is not created) */
+	uint8_t StagesArr[OS_CHAIN_MAX_STAGES];		/* Priorities of the stages tasks in pipeline order */
+	void (*StageFunctionsArr[OS_CHAIN_MAX_STAGES])(void);	/* Stages functions in pipeline order */
+	uint32_t StartCycle;						/* Cycle count at which the head stage of the current run started */
+	uint8_t DataStage;							/* Index of the stage that handed the data over */
+	uint8_t DataSize;							/* Size of the handed over data (0 if nothing handed over) */
+	uint8_t Data[OS_CHAIN_DATA_SIZE];			/* Data handed over from a stage to the next one */
+	OS_ChainStats_t Stats;						/* End to end latency statistics */
+}OS_Chain_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainCreate                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_ChainId                                           */
+/*                 Brief: Index of the chain in the chains table                  */
+/*                 Range: (0 --> OS_NUM_OF_CHAINS - 1)                            */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: Periodicity of the head stage in OS ticks, 0 for a      */
+/*                        chain only started through OS_ReleaseTask on its head   */
+/*                 -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pPriorities                                */
+/*                 Brief: Priorities of the stages tasks in pipeline order        */
+/*                 -------------------------------------------------------------- */
+/*                 void (* const * Copy_pFunctions)(void)                         */
+/*                 Brief: Stages functions in pipeline order                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_NumOfStages                                       */
+/*                 Brief: Number of stages                                        */
+/*                 Range: (2 --> OS_CHAIN_MAX_STAGES)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task per stage and links every stage to the next     */
+/*                 one, must be called before OS_Init like TASKS_CREATION         */
+/*                 (one of the NUM_OF_CREATED_TASKS descriptors per stage)        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ChainCreate(uint8_t Copy_ChainId, uint8_t Copy_Periodicity, const uint8_t* Copy_pPriorities,
+							  void (* const * Copy_pFunctions)(void), uint8_t Copy_NumOfStages);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainHandOver                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const void* Copy_pData                                         */
+/*                 Brief: Pointer to the output of the running stage              */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Size                                              */
+/*                 Brief: Size of the output in bytes                             */
+/*                 Range: (1 --> OS_CHAIN_DATA_SIZE)                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Hands the output of the running stage over to the next stage   */
+/*                 of its chain, to be called from a stage function only          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ChainHandOver(const void* Copy_pData, uint8_t Copy_Size);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainReceive                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Size                                              */
+/*                 Brief: Size of the data buffer, must match handed over size    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : void* Copy_pData                                               */
+/*                 Brief: Pointer to where the handed over data is copied         */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (RT_NOK if previous stage handed nothing over   */
+/*                 or handed over data of another size)                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the data handed over by the previous stage of the chain   */
+/*                 of the running stage, to be called from a stage function only  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ChainReceive(void* Copy_pData, uint8_t Copy_Size);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainGetStats                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_ChainId                                           */
+/*                 Brief: Index of the chain                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_ChainStats_t* Copy_pStats                                   */
+/*                 Brief: Pointer to where end to end latency statistics are      */
+/*                        copied                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the end to end latency statistics of a chain              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ChainGetStats(uint8_t Copy_ChainId, OS_ChainStats_t* Copy_pStats);
+
+#endif /* OS_CHAIN_H_ */
@@ -0,0 +1,489 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Schedular                 */
+/*     			    Description	 : OS Config                    */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_CONFIG_H_
+#define OS_CONFIG_H_
+
+/*-------------------------------------------------------*/
+/* Set the CPU (HCLK) clock frequency in Hz, used to     */
+/* convert times given in microseconds to CPU cycles     */
+/* counted by the DWT cycle counter :-                   */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_CPU_CLOCK_HZ				8000000UL  /* Default: 8000000UL (HSE) */
+
+/*-------------------------------------------------------*/
+/* Set the OS tick (schedular pass) period in SysTick    */
+/* ticks, one SysTick tick is 1 us with an 8 MHz HCLK    */
+/* and the AHB/8 SysTick clock source :-                 */
+/*                                                       */
+/* Range  : STK_MIN_VALUE --> STK_MAX_VALUE              */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_TICK_PERIOD				1000000UL  /* Default: 1000000UL (1 sec) */
+
+/*-------------------------------------------------------*/
+/* Set the maximum number of times a seqlock reader      */
+/* retries copying the shared data when it is torn by    */
+/* a writer before giving up and returning BUSY_FUNC :-  */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_SEQLOCK_MAX_RETRIES		8U  /* Default: 8U */
+
+/*-------------------------------------------------------*/
+/* Set the number of topics in the publish/subscribe     */
+/* blackboard table :-                                   */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_NUM_OF_TOPICS			4U  /* Default: 4U */
+
+/*-------------------------------------------------------*/
+/* Set the maximum size in bytes of a topic value, every */
+/* topic reserves this size in the topics table :-       */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_TOPIC_MAX_SIZE			16U  /* Default: 16U */
+
+/*-------------------------------------------------------*/
+/* Set the maximum number of aperiodic jobs waiting for  */
+/* the job server :-                                     */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_SERVER_QUEUE_SIZE		8U  /* Default: 8U */
+
+/*-------------------------------------------------------*/
+/* Set the number of background jobs the idle loop can   */
+/* run in turn :-                                        */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_NUM_OF_IDLE_JOBS			4U  /* Default: 4U */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable sleeping (WFI) in the idle loop until  */
+/* the next interrupt once every background job has      */
+/* finished its current round of work :-                 */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_IDLE_SLEEP				ENABLE  /* Default: ENABLE */
+
+/*-------------------------------------------------------*/
+/* Set the number of flash words summed by one slice of  */
+/* the flash checksum background job :-                  */
+/*                                                       */
+/* Range  : 1 --> 65535                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_IDLE_CHECKSUM_SLICE		64U  /* Default: 64U */
+
+/*-------------------------------------------------------*/
+/* Set the number of task chains (pipelines of tasks     */
+/* released one after the other in the same pass) :-     */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_NUM_OF_CHAINS			2U  /* Default: 2U */
+
+/*-------------------------------------------------------*/
+/* Set the maximum number of stages (tasks) of a chain :-*/
+/*                                                       */
+/* Range  : 2 --> NUM_OF_TASKS                           */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_CHAIN_MAX_STAGES			3U  /* Default: 3U */
+
+/*-------------------------------------------------------*/
+/* Set the maximum size in bytes of the data handed over */
+/* from a chain stage to the next one :-                 */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_CHAIN_DATA_SIZE			16U  /* Default: 16U */
+
+/*-------------------------------------------------------*/
+/* Set the number of events each active object can keep  */
+/* waiting in its private queue :-                       */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_AO_QUEUE_SIZE			8U  /* Default: 8U */
+
+/*-------------------------------------------------------*/
+/* Select the scheduling mode :-                         */
+/*                                                       */
+/* Options  : - OS_COOPERATIVE    (tasks run one after   */
+/*                                 the other in the tick */
+/*                                 and event passes)     */
+/*            - OS_PREEMPTIVE_SRP (higher priority tasks */
+/*                                 preempt lower ones on */
+/*                                 the one shared stack) */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_SCHEDULING_MODE			OS_COOPERATIVE  /* Default: OS_COOPERATIVE */
+
+/*-------------------------------------------------------*/
+/* Set the NVIC priority level of the highest priority   */
+/* task (priority 0) in OS_PREEMPTIVE_SRP mode, task i   */
+/* runs at level (this value + i), interrupts needing to */
+/* preempt every task use lower levels :-               */
+/*                                                       */
+/* Range  : 1 --> (15 - NUM_OF_TASKS)                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_SRP_HIGHEST_TASK_LEVEL	4U  /* Default: 4U */
+
+/*-------------------------------------------------------*/
+/* Set the number of resources shared between tasks and  */
+/* locked through their ceilings :-                      */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_NUM_OF_RESOURCES			4U  /* Default: 4U */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable the static task set: the tasks listed  */
+/* in OS_STATIC_TASK_LIST are dispatched by an unrolled  */
+/* tick pass with direct calls and constant periods      */
+/* instead of the task table (TASKS_CREATION, the        */
+/* runtime task APIs, OS_BUDGET_ENFORCEMENT and          */
+/* OS_LATENCY_HISTOGRAMS are not served in that case) :- */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_STATIC_TASK_SET			DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* List the static task set in priority order (highest   */
+/* first), one OS_STATIC_TASK(Function, Periodicity)     */
+/* entry per task, the hyperperiod is the least common   */
+/* multiple of the periods (computed at compile time) :- */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_STATIC_TASK_LIST(OS_STATIC_TASK)		\
+		OS_STATIC_TASK(RED_LED_TASK    , 1U)	\
+		OS_STATIC_TASK(YELLOW_LED_TASK , 2U)	\
+		OS_STATIC_TASK(GREEN_LED_TASK  , 5U)
+
+/*-------------------------------------------------------*/
+/* Enable/Disable the cyclic executive: SysTick fires    */
+/* once per minor frame and the tasks of each frame are  */
+/* taken from the table generated by                     */
+/* Tools/cyclic_table.py in Inc/OS_CyclicTable.h, task   */
+/* periodicities are not used in that case :-            */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_CYCLIC_EXECUTIVE			DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable task budget enforcement: a task still  */
+/* running once its budget (OS_TaskSetBudget) is spent   */
+/* is reported through TIM2 channel 1 compare (TIM2 is   */
+/* then reserved to the OS) :-                           */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_BUDGET_ENFORCEMENT		DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* Set the action taken on a task exceeding its budget,  */
+/* on top of counting it and calling the overrun         */
+/* callback :-                                           */
+/*                                                       */
+/* Options  : - OS_BUDGET_NOTIFY  (nothing more)         */
+/*            - OS_BUDGET_SUSPEND (suspended once it     */
+/*                                 returns)              */
+/*            - OS_BUDGET_DEMOTE  (lowest task level     */
+/*                                 until it returns,     */
+/*                                 OS_PREEMPTIVE_SRP     */
+/*                                 only)                 */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_BUDGET_ACTION			OS_BUDGET_NOTIFY  /* Default: OS_BUDGET_NOTIFY */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable overload management: tasks below the   */
+/* overload level switch to their degraded mode when the */
+/* tick pass load crosses OS_OVERLOAD_ENTER_LOAD         */
+/* (OS_COOPERATIVE mode with the table driven schedular  */
+/* only) :-                                              */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_OVERLOAD_MANAGEMENT		DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* Set the number of task criticality levels, tasks at   */
+/* the highest level are never degraded :-               */
+/*                                                       */
+/* Range  : 2 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_NUM_OF_CRITICALITY_LEVELS	3U  /* Default: 3U */
+
+/*-------------------------------------------------------*/
+/* Set the tick pass load (percent of one tick) from     */
+/* which the overload level is raised :-                 */
+/*                                                       */
+/* Range  : (OS_OVERLOAD_EXIT_LOAD + 1) --> 100          */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_OVERLOAD_ENTER_LOAD		80U  /* Default: 80U */
+
+/*-------------------------------------------------------*/
+/* Set the tick pass load (percent of one tick) under    */
+/* which passes count toward dropping the level :-       */
+/*                                                       */
+/* Range  : 0 --> (OS_OVERLOAD_ENTER_LOAD - 1)           */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_OVERLOAD_EXIT_LOAD		50U  /* Default: 50U */
+
+/*-------------------------------------------------------*/
+/* Set the minimum number of ticks between two raises of */
+/* the overload level :-                                 */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_OVERLOAD_HOLD_TICKS		2U  /* Default: 2U */
+
+/*-------------------------------------------------------*/
+/* Set the number of passes in a row under               */
+/* OS_OVERLOAD_EXIT_LOAD needed to drop the overload     */
+/* level by one :-                                       */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_OVERLOAD_EXIT_TICKS		5U  /* Default: 5U */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable time partitions: the windows of        */
+/* OS_PARTITION_LIST repeat every major frame and only   */
+/* the tasks of the partition owning the current window  */
+/* are started (OS_COOPERATIVE mode with the table       */
+/* driven schedular only) :-                             */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_PARTITIONING				DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* List the partitions in window order, one              */
+/* OS_PARTITION(WindowTicks, TasksMask, Policy) entry    */
+/* per partition, every task belongs to exactly one     */
+/* partition (checked at compile time) :-                */
+/*                                                       */
+/* Policy : - OS_PARTITION_PRIORITY                      */
+/*          - OS_PARTITION_ROUND_ROBIN                   */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_PARTITION_LIST(OS_PARTITION)									\
+		OS_PARTITION(1U, 0x00000001UL, OS_PARTITION_PRIORITY)			\
+		OS_PARTITION(1U, 0x00000006UL, OS_PARTITION_ROUND_ROBIN)
+
+/*-------------------------------------------------------*/
+/* Enable/Disable CPU load accounting: cycles spent in   */
+/* the schedular passes and tasks are measured to report */
+/* the instantaneous, 1 s, 10 s and 60 s load and the    */
+/* share of every task :-                                */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_LOAD_ACCOUNTING			ENABLE  /* Default: ENABLE */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable release jitter and response time       */
+/* histograms: every task run records its start and      */
+/* completion times from its nominal release in CPU      */
+/* cycles (requires STK_ENTRY_CAPTURE) :-                */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_LATENCY_HISTOGRAMS		DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* Set the number of buckets of every histogram, bucket  */
+/* n > 0 counts times from 2^(n-1) to 2^n - 1 cycles and */
+/* the last bucket every longer time :-                  */
+/*                                                       */
+/* Range  : 2 --> 32                                     */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_HISTOGRAM_NUM_OF_BUCKETS	20U  /* Default: 20U */
+
+/*-------------------------------------------------------*/
+/* Set the number of stack regions watched by the stack  */
+/* scan background job, region 0 is the main stack and   */
+/* the others are registered at run time :-              */
+/*                                                       */
+/* Range  : 1 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_NUM_OF_STACK_REGIONS		2U  /* Default: 2U */
+
+/*-------------------------------------------------------*/
+/* Set the number of stack words checked by one slice of */
+/* the stack scan background job :-                      */
+/*                                                       */
+/* Range  : 1 --> 65535                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_STACK_SCAN_SLICE			32U  /* Default: 32U */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable the sampling profiler: TIM3 interrupts */
+/* at the highest priority and counts the interrupted    */
+/* program counter in a histogram of code address        */
+/* ranges (TIM3 is then reserved to the OS) :-           */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_PROFILER					DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* Set the profiler sampling rate in Hz, every sample    */
+/* costs one short interrupt :-                          */
+/*                                                       */
+/* Range  : 16 --> 100000                                */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_PROFILER_SAMPLE_RATE_HZ	1000UL  /* Default: 1000UL */
+
+/*-------------------------------------------------------*/
+/* Set the size of the code address range of a profiler  */
+/* bucket as a power of 2 (5 --> 32 bytes) :-            */
+/*                                                       */
+/* Range  : 1 --> 16                                     */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_PROFILER_BUCKET_SHIFT	5U  /* Default: 5U */
+
+/*-------------------------------------------------------*/
+/* Set the number of profiler buckets (2 bytes of RAM    */
+/* each), they cover the flash from its start address :- */
+/*                                                       */
+/* Range  : 1 --> 65535                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_PROFILER_NUM_OF_BUCKETS	1024U  /* Default: 1024U */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable function entry/exit tracing: sources   */
+/* listed in OS_TRACE_SOURCES of the build are compiled  */
+/* with -finstrument-functions and record every entry    */
+/* and exit in a RAM ring buffer :-                      */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_FUNCTION_TRACE			DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* Set the number of records of the function trace ring  */
+/* buffer (4 bytes of RAM each), the oldest records are  */
+/* overwritten once it is full :-                        */
+/*                                                       */
+/* Range  : 2 --> 65536 (power of 2)                     */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_TRACE_NUM_OF_RECORDS		512U  /* Default: 512U */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable the interrupt latency harness: latency */
+/* from SysTick expiry to its handler and to the first   */
+/* task run by the tick pass, plus latencies recorded by */
+/* the application, go to log2 histograms (requires      */
+/* OS_LATENCY_HISTOGRAMS and STK_ENTRY_CAPTURE) :-       */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_INTERRUPT_LATENCY		DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* Set the number of latency sources, sources 0 and 1    */
+/* are measured by the OS and the others are free for    */
+/* application interrupts :-                             */
+/*                                                       */
+/* Range  : 2 --> 255                                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_NUM_OF_LATENCY_SOURCES	4U  /* Default: 4U */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable the deferred formatting binary log:    */
+/* OS_LOG calls store a format string ID and their raw   */
+/* arguments in a RAM ring buffer, the format strings    */
+/* stay out of the image and Tools/log_decode.py formats */
+/* the records on the host :-                            */
+/*                                                       */
+/* Options  : - ENABLE                                   */
+/*            - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_BINARY_LOG				DISABLE  /* Default: DISABLE */
+
+/*-------------------------------------------------------*/
+/* Set the number of 32-bit words of the binary log ring */
+/* buffer, a record takes 2 words plus one per argument  */
+/* and new records are dropped while it is full :-       */
+/*                                                       */
+/* Range  : 16 --> 65536 (power of 2)                    */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_LOG_NUM_OF_WORDS			256U  /* Default: 256U */
+
+/*-------------------------------------------------------*/
+/* Set the least severe level kept by the binary log,    */
+/* calls of lower severity levels compile to nothing :-  */
+/*                                                       */
+/* Options  : - OS_LOG_LEVEL_ERROR                       */
+/*            - OS_LOG_LEVEL_WARNING                     */
+/*            - OS_LOG_LEVEL_INFO                        */
+/*            - OS_LOG_LEVEL_DEBUG                       */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define OS_LOG_LEVEL				OS_LOG_LEVEL_INFO  /* Default: OS_LOG_LEVEL_INFO */
+
+#endif /* OS_CONFIG_H_ */
@@ -0,0 +1,70 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Cyclic                    */
+/*     			    Description	 : OS Cyclic Header File        */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_CYCLIC_H_
+#define OS_CYCLIC_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_CYCLIC_EXECUTIVE enabled, SysTick fires once per minor frame and the tick pass only  */
+/*            looks up the tasks of the current frame in OS_CYCLIC_FRAME_TABLE and runs them in priority   */
+/*            order. No release decision is taken at run time, task periodicities are ignored.             */
+/*                                                                                                         */
+/*  Note(2) : The frame table (Inc/OS_CyclicTable.h) is generated at build time by Tools/cyclic_table.py   */
+/*            from the periods and WCETs listed in Tools/cyclic_tasks.txt, regenerate it after any change  */
+/*            of the task set.                                                                             */
+/*                                                                                                         */
+/*  Note(3) : A frame overruns when its tasks are still running as the next SysTick becomes pending. The   */
+/*            overrun is counted with the frame it happened in, the next frame then starts late.           */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_CyclicExecutive                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs the tasks of the current minor frame and checks it for    */
+/*                 overrun, called every minor frame instead of SCHEDULAR when    */
+/*                 OS_CYCLIC_EXECUTIVE is enabled                                 */
+/*--------------------------------------------------------------------------------*/
+void OS_CyclicExecutive(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_CyclicGetOverruns                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pOverrunCount                                   */
+/*                 Brief: Number of overrun frames since OS_Init                  */
+/*                 -------------------------------------------------------------- */
+/*                 uint16_t* Copy_pLastOverrunFrame                               */
+/*                 Brief: Index of the last overrun frame in the major frame      */
+/*                        (may be NULL)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the frame overrun statistics of the cyclic executive      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_CyclicGetOverruns(uint32_t* Copy_pOverrunCount, uint16_t* Copy_pLastOverrunFrame);
+
+#endif /* OS_CYCLIC_H_ */
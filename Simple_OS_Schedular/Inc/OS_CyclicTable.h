@@ -0,0 +1,40 @@
+/****************************************************************/
+/*  SWC          : OS Cyclic                                    */
+/*  Description  : OS Cyclic Frame Table                        */
+/*  Generated by Tools/cyclic_table.py, do not edit             */
+/****************************************************************/
+
+#ifndef OS_CYCLICTABLE_H_
+#define OS_CYCLICTABLE_H_
+
+/*
+ * Task set (utilization 0.0003):
+ *    0  RED_LED_TASK             period    1000000 us  WCET      200 us
+ *    1  YELLOW_LED_TASK          period    2000000 us  WCET      200 us
+ *    2  GREEN_LED_TASK           period    5000000 us  WCET      200 us
+ *
+ * Major frame 10000000 us, minor frame 1000000 us
+ */
+
+/* Length of a minor frame in microseconds (SysTick period) */
+#define OS_CYCLIC_MINOR_FRAME_US		1000000UL
+
+/* Number of minor frames in the major frame */
+#define OS_CYCLIC_NUM_OF_FRAMES			10U
+
+/* One mask of the tasks run in every minor frame (bit number = task priority) */
+#define OS_CYCLIC_FRAME_TABLE											\
+		{															\
+			0x00000007UL,	/* Frame   0, slack   999400 us : RED_LED_TASK, YELLOW_LED_TASK, GREEN_LED_TASK */	\
+			0x00000001UL,	/* Frame   1, slack   999800 us : RED_LED_TASK */	\
+			0x00000003UL,	/* Frame   2, slack   999600 us : RED_LED_TASK, YELLOW_LED_TASK */	\
+			0x00000001UL,	/* Frame   3, slack   999800 us : RED_LED_TASK */	\
+			0x00000003UL,	/* Frame   4, slack   999600 us : RED_LED_TASK, YELLOW_LED_TASK */	\
+			0x00000005UL,	/* Frame   5, slack   999600 us : RED_LED_TASK, GREEN_LED_TASK */	\
+			0x00000003UL,	/* Frame   6, slack   999600 us : RED_LED_TASK, YELLOW_LED_TASK */	\
+			0x00000001UL,	/* Frame   7, slack   999800 us : RED_LED_TASK */	\
+			0x00000003UL,	/* Frame   8, slack   999600 us : RED_LED_TASK, YELLOW_LED_TASK */	\
+			0x00000001UL 	/* Frame   9, slack   999800 us : RED_LED_TASK */	\
+		}
+
+#endif /* OS_CYCLICTABLE_H_ */
@@ -0,0 +1,232 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Histogram                 */
+/*     			    Description	 : OS Histogram Header File     */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_HISTOGRAM_H_
+#define OS_HISTOGRAM_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_LATENCY_HISTOGRAMS enabled every task run records two times in CPU cycles from the   */
+/*            nominal release of the task: its release jitter (start time) and its response time           */
+/*            (completion time). Each one goes to a per-task histogram of log2 buckets with its count,     */
+/*            minimum and maximum, so tail latency is kept without storing samples.                        */
+/*                                                                                                         */
+/*  Note(2) : The nominal release of a task released by a tick pass (periodic, self-timed, OS_ReleaseTask, */
+/*            cyclic frame) is the SysTick expiry, rebuilt from the cycle count captured at                */
+/*            SysTick_Handler entry (STK_ENTRY_CAPTURE), so interrupt latency of the tick pass is part of  */
+/*            the jitter. An event activation (OS_TaskActivate) is released when the event came. A         */
+/*            deferred one is released when the pass taking it runs: nothing wakes the CPU once its        */
+/*            minimum inter-arrival time elapsed, so it waits for the next tick or event pass and that     */
+/*            wait is part of the deferral, not of the jitter.                                             */
+/*                                                                                                         */
+/*  Note(3) : The cycle counter stops while the CPU sleeps, a release waiting across an idle sleep (for    */
+/*            instance for the window of its partition) is recorded short by the sleep time. Tasks of the  */
+/*            unrolled static schedular do not go through OS_ExecuteTask, so OS_STATIC_TASK_SET rejects    */
+/*            OS_LATENCY_HISTOGRAMS at build time.                                                         */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t Count;											/* Number of recorded times */
+	uint32_t Min;											/* Shortest recorded time in cycles (0 if none) */
+	uint32_t Max;											/* Longest recorded time in cycles */
+	uint16_t BucketsArr[OS_HISTOGRAM_NUM_OF_BUCKETS];		/* Recorded times per log2 bucket (saturated at 0xFFFF) */
+}OS_Histogram_t;
+
+typedef struct
+{
+	uint32_t ReleaseCycle;									/* Nominal release of the run, taken at its start */
+	uint32_t StartCycle;									/* Cycle count at which the task was started */
+}OS_HistogramTaskState_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Histogram kinds */
+#define OS_HISTOGRAM_JITTER				0U	/* Start time minus nominal release time */
+#define OS_HISTOGRAM_RESPONSE			1U	/* Completion time minus nominal release time */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramTickStart                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Takes the SysTick expiry as nominal release of the tasks       */
+/*                 released by this pass, called at the start of the tick pass    */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramTickStart(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramEventStart                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Takes the current time as nominal release of the tasks         */
+/*                 released by this pass, called at the start of the event pass   */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramEventStart(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramStampEvent                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task activated by an event              */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_CycleCount                                       */
+/*                 Brief: Cycle count at which the activation was accepted        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the nominal release of an event activation, called by     */
+/*                 OS_TaskActivate and for deferred activations                   */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramStampEvent(uint8_t Copy_Priority, uint32_t Copy_CycleCount);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramStampPass                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_ReleasedTasks                                    */
+/*                 Brief: Tasks released by the current pass                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the nominal release of the released tasks that were not   */
+/*                 activated by an event to the start of the current pass         */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramStampPass(uint32_t Copy_ReleasedTasks);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramTaskStart                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task being started                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_HistogramTaskState_t* Copy_pState                           */
+/*                 Brief: Release and start of the run for OS_HistogramRecord     */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Takes the nominal release and start time of a task run, so a   */
+/*                 new release during the run does not change them, called by     */
+/*                 OS_ExecuteTask                                                 */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramTaskStart(uint8_t Copy_Priority, OS_HistogramTaskState_t* Copy_pState);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramRecord                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task that returned                      */
+/*                 -------------------------------------------------------------- */
+/*                 const OS_HistogramTaskState_t* Copy_pState                     */
+/*                 Brief: State filled by OS_HistogramTaskStart                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records the release jitter and response time of a task run,    */
+/*                 called by OS_ExecuteTask                                       */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramRecord(uint8_t Copy_Priority, const OS_HistogramTaskState_t* Copy_pState);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramAdd                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_Cycles                                           */
+/*                 Brief: Time to be recorded in cycles                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Histogram_t* Copy_pHistogram                                */
+/*                 Brief: Histogram the time is added to                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Adds a time to its log2 bucket and updates count, min and max, */
+/*                 not protected against a concurrent add, read or reset          */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramAdd(OS_Histogram_t* Copy_pHistogram, uint32_t Copy_Cycles);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramRead                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Kind                                              */
+/*                 Brief: OS_HISTOGRAM_JITTER or OS_HISTOGRAM_RESPONSE            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_Histogram_t* Copy_pHistogram                                */
+/*                 Brief: Copy of the histogram                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets a consistent copy of a histogram of a task                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_HistogramRead(uint8_t Copy_Priority, uint8_t Copy_Kind, OS_Histogram_t* Copy_pHistogram);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramReset                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Clears both histograms of a task                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_HistogramReset(uint8_t Copy_Priority);
+
+#endif /* OS_HISTOGRAM_H_ */
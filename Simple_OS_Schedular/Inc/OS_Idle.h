@@ -0,0 +1,129 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Idle                      */
+/*     			    Description	 : OS Idle Header File          */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_IDLE_H_
+#define OS_IDLE_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : Background jobs run in thread mode from the while(1) loop of main() through OS_IdleRun, so   */
+/*            the SysTick interrupt (and every task it dispatches) preempts them at any time. They only    */
+/*            use CPU time left over by the periodic tasks and never delay a deadline.                     */
+/*                                                                                                         */
+/*  Note(2) : A job must do a bounded slice of work per call and return OS_IDLE_JOB_PENDING while it has   */
+/*            more to do, or OS_IDLE_JOB_DONE once its current round of work is complete. Jobs are called  */
+/*            in turn, one slice each, so a long job never starves the others.                             */
+/*                                                                                                         */
+/*  Note(3) : When every job reports OS_IDLE_JOB_DONE in the same round, the idle loop sleeps (WFI) until  */
+/*            the next interrupt if OS_IDLE_SLEEP is enabled, then starts a new round.                     */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Background job return values */
+#define OS_IDLE_JOB_DONE				0U
+#define OS_IDLE_JOB_PENDING				1U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleJobCreate                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_JobId                                             */
+/*                 Brief: Index of the job in the background jobs table           */
+/*                 Range: (0 --> OS_NUM_OF_IDLE_JOBS - 1)                         */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t (*Copy_pJob)(void)                                     */
+/*                 Brief: Job function doing one bounded slice of work per call   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Registers a background job to be run by the idle loop          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_IdleJobCreate(uint8_t Copy_JobId, uint8_t (*Copy_pJob)(void));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleJobDelete                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_JobId                                             */
+/*                 Brief: Index of the job to be removed                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Removes a background job from the idle loop                    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_IdleJobDelete(uint8_t Copy_JobId);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleRun                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs one slice of the next background job, to be called over   */
+/*                 and over from the while(1) loop of main()                      */
+/*--------------------------------------------------------------------------------*/
+void OS_IdleRun(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleFlashChecksumJob                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t (OS_IDLE_JOB_DONE once the whole image was summed)     */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Ready made background job summing OS_IDLE_CHECKSUM_SLICE words */
+/*                 of the flash image per call, pass it to OS_IdleJobCreate       */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_IdleFlashChecksumJob(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleGetFlashChecksum                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pChecksum                                       */
+/*                 Brief: Checksum of the flash image from the last full pass     */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pPasses                                         */
+/*                 Brief: Number of full passes completed (may be NULL)           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (RT_NOK if no full pass completed yet)          */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the result of the flash checksum background job           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_IdleGetFlashChecksum(uint32_t* Copy_pChecksum, uint32_t* Copy_pPasses);
+
+#endif /* OS_IDLE_H_ */
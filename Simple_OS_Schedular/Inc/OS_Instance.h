@@ -0,0 +1,276 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Instance                  */
+/*     			    Description	 : OS Instance Header File      */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_INSTANCE_H_
+#define OS_INSTANCE_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : An OS_Schedular_t holds the whole state of one schedular: its task table, tick counter,      */
+/*            release masks and policy. The default kernel is itself the instance Global_Schedular passed  */
+/*            to SCHEDULAR by SysTick, any number of other instances can coexist, each driven by calling   */
+/*            OS_InstanceTick from its own clock source (a timer interrupt, another instance task or a     */
+/*            host side test loop), so for instance a fast and a slow timer domain run side by side.       */
+/*                                                                                                         */
+/*  Note(2) : OS_SCHEDULAR_DEFINE allocates an instance with its task table statically, OS_INSTANCE_TASK   */
+/*            defines the constant descriptor of a task passed to OS_InstanceTaskCreate, which the task    */
+/*            table keeps referencing. Tasks of an instance run to completion in the context calling       */
+/*            OS_InstanceTick, in priority order (OS_INSTANCE_PRIORITY) or in turn starting after the last */
+/*            one served (OS_INSTANCE_ROUND_ROBIN).                                                        */
+/*                                                                                                         */
+/*  Note(3) : Instances go through the same SCHEDULAR and dispatcher as the default kernel: periodic and   */
+/*            on demand releases, self-timed tasks, suspend and resume, period changes and chains of       */
+/*            successors. Event activation (OS_TaskActivate runs the PendSV event pass),                   */
+/*            OS_PREEMPTIVE_SRP, partitions, budgets, load accounting and histograms are indexed by the    */
+/*            priorities of the default kernel and stay with it.                                           */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Define an instance with its own task table at file scope (1 to 32 task slots, one bit per task in release masks) */
+#define OS_SCHEDULAR_DEFINE(Copy_Name,Copy_NumOfTasks,Copy_Policy)																	\
+		_Static_assert((Copy_NumOfTasks) >= 1 && (Copy_NumOfTasks) <= 32, " OS_SCHEDULAR_DEFINE Requires 1 To 32 Task Slots !");	\
+		_Static_assert((Copy_Policy) <= OS_INSTANCE_ROUND_ROBIN, " Wrong OS_SCHEDULAR_DEFINE Policy !");							\
+		static Task_t Copy_Name##_TasksArr[(Copy_NumOfTasks)];																		\
+		OS_Schedular_t Copy_Name = {Copy_Name##_TasksArr, (Copy_NumOfTasks), (Copy_Policy), 0, 0, 0, 0, 0, 0, 0}
+
+/* Define the constant descriptor of an instance task, passed to OS_InstanceTaskCreate */
+#define OS_INSTANCE_TASK(Copy_Function,Copy_Priority,Copy_Periodicity,Copy_Offset)							\
+		void Copy_Function(void);																		\
+		const OS_TaskDescriptor_t OS_InstanceTask_##Copy_Function = {Copy_Function, (Copy_Priority), (Copy_Periodicity), (Copy_Offset)}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceInit                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : Task_t* Copy_pTasksArr                                         */
+/*                 Brief: Task table of the instance                              */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_NumOfTasks                                        */
+/*                 Brief: Number of task slots in the table                       */
+/*                 Range: (1 --> 32)                                              */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Policy                                            */
+/*                 Brief: OS_INSTANCE_PRIORITY or OS_INSTANCE_ROUND_ROBIN         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance to be initialized                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Initializes an instance with no task over the passed table     */
+/*                 (not needed for instances made with OS_SCHEDULAR_DEFINE)       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceInit(OS_Schedular_t* Copy_pInstance, Task_t* Copy_pTasksArr, uint8_t Copy_NumOfTasks, uint8_t Copy_Policy);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskCreate                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_TaskDescriptor_t* Copy_pDescriptor                    */
+/*                 Brief: Constant descriptor of the task (OS_INSTANCE_TASK),     */
+/*                        priority and periodicity counted in the instance, kept  */
+/*                        referenced by the task table                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task is created in                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task in an instance, first released one period plus  */
+/*                 offset from now                                                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskCreate(OS_Schedular_t* Copy_pInstance, const OS_TaskDescriptor_t* Copy_pDescriptor);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskCreateSelfTimed                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t(*Copy_Fptr)(void)                                     */
+/*                 Brief: Task function, returns the instance ticks until its     */
+/*                        next release (0 is taken as 1) or OS_WAIT_FOR_EVENT     */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_FirstDelay                                       */
+/*                 Brief: Instance ticks until the first release or               */
+/*                        OS_WAIT_FOR_EVENT                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task is created in                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task with a variable period in an instance, each     */
+/*                 run sets the time of its next release                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskCreateSelfTimed(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority, uint32_t (*Copy_Fptr)(void), uint32_t Copy_FirstDelay);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskDelete                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Deletes a task of an instance and frees its slot               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskDelete(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceReleaseTask                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Releases a task on the next tick of its instance, safe to be   */
+/*                 called from ISRs                                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceReleaseTask(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskSuspend                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stops releasing a task of an instance until it is resumed      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskSuspend(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskResume                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes a suspended task of an instance on its original        */
+/*                 release grid                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskResume(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskChangePeriod                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: New periodicity in instance ticks, 0 for a task that    */
+/*                        only runs when released on demand                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Changes the periodicity of a task of an instance from its      */
+/*                 already planned next release                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskChangePeriod(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority, uint8_t Copy_Periodicity);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskSetSuccessors                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the predecessor task in the instance        */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_SuccessorsMask                                   */
+/*                 Brief: One bit per task of the instance to be released once    */
+/*                        the predecessor completes, 0 for none                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the tasks of an instance released in the same pass        */
+/*                 right after a task completes                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskSetSuccessors(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority, uint32_t Copy_SuccessorsMask);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTick                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance whose clock source ticked                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Schedular pass of an instance: counts the tick, releases its   */
+/*                 due tasks and runs every ready task with the instance policy   */
+/*--------------------------------------------------------------------------------*/
+void OS_InstanceTick(OS_Schedular_t* Copy_pInstance);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceGetTickCount                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_Schedular_t* Copy_pInstance                           */
+/*                 Brief: Instance to be read                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t                                                       */
+/*                 Brief: Ticks of the instance so far (0 for a NULL instance)    */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the tick count of an instance                             */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_InstanceGetTickCount(const OS_Schedular_t* Copy_pInstance);
+
+#endif /* OS_INSTANCE_H_ */
@@ -0,0 +1,175 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Latency                   */
+/*     			    Description	 : OS Latency Header File       */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_LATENCY_H_
+#define OS_LATENCY_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_INTERRUPT_LATENCY enabled every latency is recorded in CPU cycles in the log2        */
+/*            histogram of its source (OS_Histogram_t), with its count, minimum and maximum.               */
+/*                                                                                                         */
+/*  Note(2) : OS_LATENCY_SYSTICK_ENTRY is the time from SysTick expiry to the first instruction of         */
+/*            SysTick_Handler, taken from the cycle count and SysTick count the handler captures before    */
+/*            touching the timer (STK_ENTRY_CAPTURE), so its resolution is one SysTick count (8 cycles     */
+/*            with the AHB/8 clock source, 1 cycle with AHB).                                              */
+/*            OS_LATENCY_TICK_DISPATCH is the time from the same expiry to the start of the first task run */
+/*            by the tick pass, ticks releasing no task are not recorded. In OS_PREEMPTIVE_SRP mode the    */
+/*            tasks of the tick pass start from their IRQs once SysTick_Handler returns, the first of them */
+/*            to start takes the sample.                                                                   */
+/*                                                                                                         */
+/*  Note(3) : Sources from OS_LATENCY_NUM_OF_OS_SOURCES up are recorded by the application: an interrupt   */
+/*            handler computes the cycle count at which its event happened (for instance from a timer      */
+/*            compare value and the timer count) and passes it to OS_LatencyRecord at its first statement. */
+/*                                                                                                         */
+/*  Note(4) : Measure under the loads and configurations of interest, reset the histograms between runs.   */
+/*            Interrupts masked by OS_ENTER_CRITICAL and higher priority handlers show up as the tail of   */
+/*            the histograms, they are the first places to look at when tuning priorities or moving code   */
+/*            to RAM.                                                                                      */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Latency sources measured by the OS */
+#define OS_LATENCY_SYSTICK_ENTRY		0U	/* SysTick expiry to first instruction of SysTick_Handler */
+#define OS_LATENCY_TICK_DISPATCH		1U	/* SysTick expiry to start of the first task run by the tick pass */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyTickStart                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records the SysTick entry latency and takes the expiry time    */
+/*                 for the dispatch latency, called at the start of the tick pass */
+/*--------------------------------------------------------------------------------*/
+void OS_LatencyTickStart(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyTickEnd                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Drops the dispatch latency of a tick that started no task and  */
+/*                 pended none, called at the end of the tick pass                */
+/*--------------------------------------------------------------------------------*/
+void OS_LatencyTickEnd(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyTasksPended                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_PendedTasks                                      */
+/*                 Brief: One bit per task IRQ pended by the pass                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Keeps the dispatch latency of a tick pass that pended task     */
+/*                 IRQs until the first of them starts, called by the             */
+/*                 OS_PREEMPTIVE_SRP dispatch                                     */
+/*--------------------------------------------------------------------------------*/
+void OS_LatencyTasksPended(uint32_t Copy_PendedTasks);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyTaskStart                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records the dispatch latency if this is the first task run by  */
+/*                 the current tick pass, called by OS_ExecuteTask                */
+/*--------------------------------------------------------------------------------*/
+void OS_LatencyTaskStart(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyRecord                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Source                                            */
+/*                 Brief: Latency source of the calling interrupt handler         */
+/*                 Range: (OS_LATENCY_NUM_OF_OS_SOURCES -->                       */
+/*                         OS_NUM_OF_LATENCY_SOURCES - 1)                         */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_EventCycle                                       */
+/*                 Brief: Cycle count at which the interrupt event happened       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records the time from an interrupt event to now in the         */
+/*                 histogram of its source                                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LatencyRecord(uint8_t Copy_Source, uint32_t Copy_EventCycle);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyRead                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Source                                            */
+/*                 Brief: Latency source                                          */
+/*                 Range: (0 --> OS_NUM_OF_LATENCY_SOURCES - 1)                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_Histogram_t* Copy_pHistogram                                */
+/*                 Brief: Copy of the latency histogram of the source             */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets a consistent copy of the latency histogram of a source    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LatencyRead(uint8_t Copy_Source, OS_Histogram_t* Copy_pHistogram);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyReset                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Source                                            */
+/*                 Brief: Latency source                                          */
+/*                 Range: (0 --> OS_NUM_OF_LATENCY_SOURCES - 1)                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Clears the latency histogram of a source                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LatencyReset(uint8_t Copy_Source);
+
+#endif /* OS_LATENCY_H_ */
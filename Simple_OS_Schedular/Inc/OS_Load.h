@@ -0,0 +1,185 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Load                      */
+/*     			    Description	 : OS Load Header File          */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_LOAD_H_
+#define OS_LOAD_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_LOAD_ACCOUNTING enabled the CPU is counted busy from the entry of the outermost      */
+/*            schedular pass or task handler to its exit, using DWT cycle count timestamps. The rest of    */
+/*            every tick (idle loop, background jobs and sleep) is idle time, so the tick period is taken  */
+/*            as the elapsed time since the cycle counter stops while the CPU sleeps (WFI).                */
+/*                                                                                                         */
+/*  Note(2) : Loads are given in hundredths of a percent (0 --> 10000), idle time is 10000 minus the load. */
+/*            The instantaneous load covers the last tick and the 1 s load the last 1 s window (one tick   */
+/*            if the tick is longer), the 10 s and 60 s loads are exponential moving averages of the 1 s   */
+/*            loads.                                                                                       */
+/*                                                                                                         */
+/*  Note(3) : A task share is the part of the last 1 s window spent in the task itself, time spent in      */
+/*            tasks preempting it (OS_PREEMPTIVE_SRP) is charged to those tasks. Tasks of the unrolled     */
+/*            static schedular (OS_STATIC_TASK_SET) are charged to their place in OS_STATIC_TASK_LIST.     */
+/*                                                                                                         */
+/*  Note(4) : Interrupts other than the schedular passes and task handlers are counted as idle time, and   */
+/*            so is the time spent in other schedular instances (OS_InstanceTick) unless they are ticked   */
+/*            from inside a task of the default schedular.                                                 */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint16_t Instant;							/* Load of the last tick */
+	uint16_t Last1s;							/* Load of the last 1 s window */
+	uint16_t Avg10s;							/* 10 s moving average of the 1 s loads */
+	uint16_t Avg60s;							/* 60 s moving average of the 1 s loads */
+}OS_LoadAverages_t;
+
+typedef struct
+{
+	uint32_t StartCycle;						/* Cycle count at which the task was dispatched */
+	uint32_t OuterNestedCycles;					/* Cycles of nested tasks counted for the preempted task */
+}OS_LoadTaskState_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Full load in hundredths of a percent */
+#define OS_LOAD_FULL					10000U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadEnter                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Marks the entry of a schedular pass, called by the tick and    */
+/*                 event passes                                                   */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadEnter(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadExit                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Marks the exit of a schedular pass, called by the tick and     */
+/*                 event passes                                                   */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadExit(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadTaskStart                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_LoadTaskState_t* Copy_pState                                */
+/*                 Brief: Accounting state to be passed to OS_LoadTaskStop        */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Starts measuring a task, called by OS_ExecuteTask              */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadTaskStart(OS_LoadTaskState_t* Copy_pState);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadTaskStop                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task that returned                      */
+/*                 -------------------------------------------------------------- */
+/*                 const OS_LoadTaskState_t* Copy_pState                          */
+/*                 Brief: Accounting state filled by OS_LoadTaskStart             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Charges the cycles spent in a task to it, called by            */
+/*                 OS_ExecuteTask                                                 */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadTaskStop(uint8_t Copy_Priority, const OS_LoadTaskState_t* Copy_pState);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadTick                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Closes the load of the last tick and of the 1 s window once    */
+/*                 it is over, called by the tick pass                            */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadTick(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadGetAverages                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_LoadAverages_t* Copy_pAverages                              */
+/*                 Brief: Instantaneous, 1 s, 10 s and 60 s loads                 */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets a consistent copy of the CPU loads                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LoadGetAverages(OS_LoadAverages_t* Copy_pAverages);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadGetTaskShare                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint16_t* Copy_pShare                                          */
+/*                 Brief: Share of the last 1 s window spent in the task          */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the CPU utilization share of a task                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LoadGetTaskShare(uint8_t Copy_Priority, uint16_t* Copy_pShare);
+
+#endif /* OS_LOAD_H_ */
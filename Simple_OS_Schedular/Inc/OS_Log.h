@@ -0,0 +1,186 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Log                       */
+/*     			    Description	 : OS Log Header File           */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_LOG_H_
+#define OS_LOG_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_BINARY_LOG enabled an OS_LOG_ERROR/WARNING/INFO/DEBUG call formats nothing on the    */
+/*            target, it writes a record of 32-bit words to Global_LogData: a header word (format string   */
+/*            ID in bits 31:16, number of arguments in bits 7:0), the CPU cycle count, then the raw        */
+/*            arguments. Records are written in a short critical section, so calls are allowed from tasks  */
+/*            and interrupt handlers alike and cost a few tens of cycles.                                  */
+/*                                                                                                         */
+/*  Note(2) : The format string, the level, the file and the line of every call are placed in the          */
+/*            .os_log_strings section, which the linker script keeps out of the flash image (INFO). The    */
+/*            format string ID is its offset in that section, Tools/log_decode.py reads the strings back   */
+/*            from Simple_OS_Schedular.elf, so the image run by the target must be the one decoded.        */
+/*                                                                                                         */
+/*  Note(3) : Arguments are cast to uint32_t: integers, characters and pointers, up to OS_LOG_MAX_ARGS per */
+/*            call, printed with %d %i %u %x %X %o %c or %p. Strings (%s) and floating point values are    */
+/*            not supported, their content is not copied.                                                  */
+/*                                                                                                         */
+/*  Note(4) : The ring buffer drops new records while it is full and counts them, so that records stay     */
+/*            whole for the reader. Either dump it from the debugger                                       */
+/*            (gdb: dump binary value log.bin Global_LogData) and run                                      */
+/*            Tools/log_decode.py Simple_OS_Schedular.elf log.bin, or drain it with OS_LogRead from a low  */
+/*            priority task to a link and run Tools/log_decode.py --stream on the received words.          */
+/*                                                                                                         */
+/*  Note(5) : The cycle count is 0 until OS_Init starts the cycle counter. With OS_BINARY_LOG disabled or  */
+/*            a level less severe than OS_LOG_LEVEL the calls compile to nothing and their arguments are   */
+/*            not evaluated.                                                                               */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t NumOfWords;								/* Number of words of the ring buffer */
+	volatile uint32_t WriteCount;						/* Number of words written so far (next word index modulo the size) */
+	volatile uint32_t ReadCount;						/* Number of words read so far by OS_LogRead or OS_LogReset */
+	volatile uint32_t DroppedCount;						/* Number of records dropped while the ring buffer was full */
+	volatile uint32_t WordsArr[OS_LOG_NUM_OF_WORDS];	/* Ring buffer of log records */
+}OS_Log_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Largest number of arguments of a log call */
+#define OS_LOG_MAX_ARGS					8U
+
+/* Turn __LINE__ into a string literal of the log call */
+#define OS_LOG_STRINGIFY(Copy_Token)	OS_LOG_STRINGIFY_(Copy_Token)
+#define OS_LOG_STRINGIFY_(Copy_Token)	#Copy_Token
+
+/* Count the arguments of a log call, more than OS_LOG_MAX_ARGS are counted as X */
+#define OS_LOG_NUM_OF_ARGS(...)			OS_LOG_NUM_OF_ARGS_(0, ##__VA_ARGS__, X, X, X, X, X, X, X, X, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define OS_LOG_NUM_OF_ARGS_(Copy_0, Copy_1, Copy_2, Copy_3, Copy_4, Copy_5, Copy_6, Copy_7, Copy_8, Copy_9, Copy_10, Copy_11, Copy_12, Copy_13, Copy_14, Copy_15, Copy_16, Copy_Count, ...)	Copy_Count
+
+/* Convert every argument of a log call to uint32_t, each one preceded by a comma */
+#define OS_LOG_CAST_ARGS(...)			OS_LOG_CAST_ARGS_(OS_LOG_NUM_OF_ARGS(__VA_ARGS__), ##__VA_ARGS__)
+#define OS_LOG_CAST_ARGS_(Copy_Count, ...)	OS_LOG_CAST_ARGS__(Copy_Count, ##__VA_ARGS__)
+#define OS_LOG_CAST_ARGS__(Copy_Count, ...)	OS_LOG_CAST_##Copy_Count(__VA_ARGS__)
+#define OS_LOG_CAST_0()
+#define OS_LOG_CAST_1(Copy_Arg)			, (uint32_t)(Copy_Arg)
+#define OS_LOG_CAST_2(Copy_Arg, ...)	, (uint32_t)(Copy_Arg) OS_LOG_CAST_1(__VA_ARGS__)
+#define OS_LOG_CAST_3(Copy_Arg, ...)	, (uint32_t)(Copy_Arg) OS_LOG_CAST_2(__VA_ARGS__)
+#define OS_LOG_CAST_4(Copy_Arg, ...)	, (uint32_t)(Copy_Arg) OS_LOG_CAST_3(__VA_ARGS__)
+#define OS_LOG_CAST_5(Copy_Arg, ...)	, (uint32_t)(Copy_Arg) OS_LOG_CAST_4(__VA_ARGS__)
+#define OS_LOG_CAST_6(Copy_Arg, ...)	, (uint32_t)(Copy_Arg) OS_LOG_CAST_5(__VA_ARGS__)
+#define OS_LOG_CAST_7(Copy_Arg, ...)	, (uint32_t)(Copy_Arg) OS_LOG_CAST_6(__VA_ARGS__)
+#define OS_LOG_CAST_8(Copy_Arg, ...)	, (uint32_t)(Copy_Arg) OS_LOG_CAST_7(__VA_ARGS__)
+#define OS_LOG_CAST_X(...)				, __VA_ARGS__
+
+/*
+ * Log a format string and up to OS_LOG_MAX_ARGS integer arguments at a level, the string is
+ * stored as "<Tag>\x1f<File>\x1f<Line>\x1f<Format>" in the non loaded .os_log_strings section
+ */
+#if OS_BINARY_LOG == ENABLE
+
+	#define OS_LOG(Copy_Level, Copy_Tag, Copy_Format, ...)																		\
+		do																													\
+		{																													\
+			if((Copy_Level) <= OS_LOG_LEVEL)																				\
+			{																												\
+				static const char Local_LogFormatArr[] __attribute__((section(".os_log_strings"), used)) =					\
+					Copy_Tag "\x1f" __FILE__ "\x1f" OS_LOG_STRINGIFY(__LINE__) "\x1f" Copy_Format;							\
+				const uint32_t Local_LogArgsArr[] = {0U OS_LOG_CAST_ARGS(__VA_ARGS__)};										\
+				_Static_assert(sizeof(Local_LogArgsArr) / sizeof(uint32_t) - 1U <= OS_LOG_MAX_ARGS, " Too many log arguments !");	\
+				OS_LogWrite((uint32_t)Local_LogFormatArr, &Local_LogArgsArr[1], sizeof(Local_LogArgsArr) / sizeof(uint32_t) - 1U);	\
+			}																												\
+			else																											\
+			{																												\
+				/* Do Nothing */																							\
+			}																												\
+		}while(0)
+
+#else
+
+	#define OS_LOG(Copy_Level, Copy_Tag, Copy_Format, ...)		do{}while(0)
+
+#endif
+
+#define OS_LOG_ERROR(Copy_Format, ...)		OS_LOG(OS_LOG_LEVEL_ERROR, "E", Copy_Format, ##__VA_ARGS__)
+#define OS_LOG_WARNING(Copy_Format, ...)	OS_LOG(OS_LOG_LEVEL_WARNING, "W", Copy_Format, ##__VA_ARGS__)
+#define OS_LOG_INFO(Copy_Format, ...)		OS_LOG(OS_LOG_LEVEL_INFO, "I", Copy_Format, ##__VA_ARGS__)
+#define OS_LOG_DEBUG(Copy_Format, ...)		OS_LOG(OS_LOG_LEVEL_DEBUG, "D", Copy_Format, ##__VA_ARGS__)
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LogWrite                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_FormatId                                         */
+/*                 Brief: Offset of the format string in .os_log_strings          */
+/*                 -------------------------------------------------------------- */
+/*                 const uint32_t* Copy_pArgs                                     */
+/*                 Brief: Arguments of the log call                               */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_NumOfArgs                                        */
+/*                 Brief: Number of arguments of the log call                     */
+/*                 Range: (0 --> OS_LOG_MAX_ARGS)                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Writes a log record, or counts it as dropped if the ring       */
+/*                 buffer is full, called by the OS_LOG macros only               */
+/*--------------------------------------------------------------------------------*/
+void OS_LogWrite(uint32_t Copy_FormatId, const uint32_t* Copy_pArgs, uint32_t Copy_NumOfArgs);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LogRead                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_MaxNumOfWords                                    */
+/*                 Brief: Size of the words buffer                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pWords                                          */
+/*                 Brief: Buffer receiving the oldest whole records               */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pNumOfWords                                     */
+/*                 Brief: Number of words copied to the buffer                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Moves the oldest records fitting in the buffer out of the ring */
+/*                 buffer, to be sent to the host by a single reader              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LogRead(uint32_t* Copy_pWords, uint32_t Copy_MaxNumOfWords, uint32_t* Copy_pNumOfWords);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LogReset                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Discards every record and clears the dropped records count     */
+/*--------------------------------------------------------------------------------*/
+void OS_LogReset(void);
+
+#endif /* OS_LOG_H_ */
@@ -0,0 +1,143 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Overload                  */
+/*     			    Description	 : OS Overload Header File      */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_OVERLOAD_H_
+#define OS_OVERLOAD_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : Every task has a criticality level (0 --> OS_NUM_OF_CRITICALITY_LEVELS - 1, 0 by default)    */
+/*            and may be given a degraded mode: a cheaper body and/or a longer period, a degraded period   */
+/*            of 0 sheds its periodic releases (event releases are still served).                          */
+/*                                                                                                         */
+/*  Note(2) : After every tick pass its load (cycles taken over the cycles of one tick) is checked. A pass */
+/*            above OS_OVERLOAD_ENTER_LOAD, or still running when the next tick was due, raises the        */
+/*            overload level by one (at most once every OS_OVERLOAD_HOLD_TICKS), every task with a         */
+/*            degraded mode and a criticality below the level then switches to it. The level drops by one  */
+/*            after OS_OVERLOAD_EXIT_TICKS passes in a row below OS_OVERLOAD_EXIT_LOAD.                    */
+/*                                                                                                         */
+/*  Note(3) : The highest criticality level is never degraded. A task switched back gets the body and      */
+/*            period it had when it was degraded, so do not change the period of a degraded task. A task   */
+/*            deleted or created again leaves its degraded mode.                                           */
+/*                                                                                                         */
+/*  Note(4) : Only served in OS_COOPERATIVE mode with the table driven schedular, where the tick pass runs */
+/*            the tasks and its length is the load of the tick.                                            */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetCriticality                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Criticality                                       */
+/*                 Brief: Criticality level of the task                           */
+/*                 Range: (0 --> OS_NUM_OF_CRITICALITY_LEVELS - 1)                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the criticality of a task, taken into account on the next */
+/*                 change of the overload level                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetCriticality(uint8_t Copy_Priority, uint8_t Copy_Criticality);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetDegradedMode                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 -------------------------------------------------------------- */
+/*                 void(*Copy_Fptr)(void)                                         */
+/*                 Brief: Body run while degraded (NULL keeps the normal body)    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: Periodicity while degraded (0 sheds periodic releases)  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gives a task a degraded mode used under overload, must be set  */
+/*                 while the system is not overloaded                             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetDegradedMode(uint8_t Copy_Priority, void(*Copy_Fptr)(void), uint8_t Copy_Periodicity);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_OverloadGetStatus                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint8_t* Copy_pLevel                                           */
+/*                 Brief: Current overload level (0 if not overloaded)            */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t* Copy_pLoad                                            */
+/*                 Brief: Load of the last tick pass in percent (may be NULL)     */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pOverrunCount                                   */
+/*                 Brief: Tick passes still running when the next tick was due    */
+/*                        (may be NULL)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the overload state of the system                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_OverloadGetStatus(uint8_t* Copy_pLevel, uint8_t* Copy_pLoad, uint32_t* Copy_pOverrunCount);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_OverloadUpdate                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_PassCycles                                       */
+/*                 Brief: CPU cycles taken by the tick pass that just ended       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Checks the load of the tick pass and raises or drops the       */
+/*                 overload level, called by the tick pass when                   */
+/*                 OS_OVERLOAD_MANAGEMENT is enabled                              */
+/*--------------------------------------------------------------------------------*/
+void OS_OverloadUpdate(uint32_t Copy_PassCycles);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_OverloadTaskReset                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task deleted or created again           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Puts the normal descriptor of a degraded task back in its slot */
+/*                 and forgets its degraded state, called by the schedular before */
+/*                 a task is deleted or created again                             */
+/*--------------------------------------------------------------------------------*/
+void OS_OverloadTaskReset(uint8_t Copy_Priority);
+
+#endif /* OS_OVERLOAD_H_ */
@@ -0,0 +1,141 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Partition                 */
+/*     			    Description	 : OS Partition Header File     */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_PARTITION_H_
+#define OS_PARTITION_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_PARTITIONING enabled the time is split into the fixed windows of OS_PARTITION_LIST,  */
+/*            repeated every major frame (the sum of the windows). Each partition owns a disjoint set of   */
+/*            tasks and only those tasks are started during its window, releases of tasks of other         */
+/*            partitions are kept until their own window.                                                  */
+/*                                                                                                         */
+/*  Note(2) : Once a window is over no new task of its partition is started even if the tick pass is still */
+/*            running, the rest waits for its next window. With OS_BUDGET_ENFORCEMENT enabled a task is    */
+/*            only started if its budget (OS_TaskSetBudget) fits in the rest of the window, otherwise it   */
+/*            waits for the next window. Tasks are never preempted in OS_COOPERATIVE mode, so the          */
+/*            isolation is best effort: a task with no budget, or running past its budget, can still run   */
+/*            into the next window and is counted as an overrun of its partition.                          */
+/*                                                                                                         */
+/*  Note(3) : Each partition has its own policy: OS_PARTITION_PRIORITY runs ready tasks in priority order, */
+/*            OS_PARTITION_ROUND_ROBIN serves ready tasks in turn starting after the last one it served,   */
+/*            so no task of a best effort partition starves when its window keeps being cut.               */
+/*                                                                                                         */
+/*  Note(4) : Every task of the system must be listed in exactly one partition, a task listed in none      */
+/*            would never be started and is rejected at compile time. Only served in OS_COOPERATIVE mode   */
+/*            with the table driven schedular.                                                             */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t WindowOffset;						/* Start of the window from the start of the major frame in OS ticks */
+	uint32_t WindowLength;						/* Length of the window in OS ticks */
+	uint32_t TasksMask;							/* One bit per task of the partition (bit number = task priority) */
+	uint8_t Policy;								/* Scheduling policy of the partition */
+	uint8_t Utilization;						/* Share of its last window spent running its tasks in percent */
+	uint32_t Overruns;							/* Windows where a task of the partition ran past the window end */
+	uint32_t DeferredJobs;						/* Releases left for the next window once the window was over */
+}OS_PartitionStats_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionInit                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Opens the window of the first partition, called by OS_Init     */
+/*                 when OS_PARTITIONING is enabled                                */
+/*--------------------------------------------------------------------------------*/
+void OS_PartitionInit(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionTick                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Moves to the window of the next partition once the current one */
+/*                 is over, called by the tick pass before SCHEDULAR              */
+/*--------------------------------------------------------------------------------*/
+void OS_PartitionTick(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionDispatch                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_ReadyTasks                                       */
+/*                 Brief: One bit per released task (bit number = task priority)  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs the ready tasks of the partition owning the current       */
+/*                 window with its policy and keeps the other releases, called by */
+/*                 the schedular passes                                           */
+/*--------------------------------------------------------------------------------*/
+void OS_PartitionDispatch(uint32_t Copy_ReadyTasks);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionGetActive                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t                                                        */
+/*                 Brief: Index of the partition owning the current window        */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the partition owning the current window                   */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_PartitionGetActive(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionGetStats                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_PartitionId                                       */
+/*                 Brief: Index of the partition in OS_PARTITION_LIST             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_PartitionStats_t* Copy_pStats                               */
+/*                 Brief: Window, tasks, policy and run time statistics           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the window and the utilization of a partition             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_PartitionGetStats(uint8_t Copy_PartitionId, OS_PartitionStats_t* Copy_pStats);
+
+#endif /* OS_PARTITION_H_ */
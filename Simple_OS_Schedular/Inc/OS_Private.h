@@ -0,0 +1,210 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Schedular                 */
+/*     			    Description	 : OS Private                   */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_PRIVATE_H_
+#define OS_PRIVATE_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           CORE REGISTERS DEFINITION                               */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+typedef struct
+{
+        volatile uint32_t CTRL;                 /* DWT control register */
+        volatile uint32_t CYCCNT;               /* DWT cycle count register */
+}DWT_t;
+
+#define DWT  ((volatile DWT_t*)0xE0001000)
+
+#define DEMCR  (*(volatile uint32_t*)0xE000EDFC)	/* Debug exception and monitor control register */
+
+#define SCB_ICSR   (*(volatile uint32_t*)0xE000ED04)	/* Interrupt control and state register */
+#define SCB_SHPR3  (*(volatile uint32_t*)0xE000ED20)	/* System handler priority register 3 */
+
+#define NVIC_ISER  ((volatile uint32_t*)0xE000E100)	/* Interrupt set-enable registers */
+#define NVIC_ISPR  ((volatile uint32_t*)0xE000E200)	/* Interrupt set-pending registers */
+#define NVIC_IPR   ((volatile uint8_t*)0xE000E400)	/* Interrupt priority registers (one byte per IRQ) */
+
+typedef struct
+{
+        volatile uint32_t CR1;                  /* TIM control register 1 */
+        volatile uint32_t CR2;                  /* TIM control register 2 */
+        volatile uint32_t SMCR;                 /* TIM slave mode control register */
+        volatile uint32_t DIER;                 /* TIM DMA/interrupt enable register */
+        volatile uint32_t SR;                   /* TIM status register */
+        volatile uint32_t EGR;                  /* TIM event generation register */
+        volatile uint32_t CCMR1;                /* TIM capture/compare mode register 1 */
+        volatile uint32_t CCMR2;                /* TIM capture/compare mode register 2 */
+        volatile uint32_t CCER;                 /* TIM capture/compare enable register */
+        volatile uint32_t CNT;                  /* TIM counter */
+        volatile uint32_t PSC;                  /* TIM prescaler */
+        volatile uint32_t ARR;                  /* TIM auto-reload register */
+        volatile uint32_t RCR;                  /* TIM repetition counter register */
+        volatile uint32_t CCR1;                 /* TIM capture/compare register 1 */
+}TIM_t;
+
+#define OS_BUDGET_TIMER  ((volatile TIM_t*)0x40000000)	/* TIM2 */
+#define OS_BUDGET_TIMER_IRQ                     28U /* TIM2 global interrupt */
+
+#define OS_PROFILER_TIMER  ((volatile TIM_t*)0x40000400)	/* TIM3 */
+#define OS_PROFILER_TIMER_IRQ                   29U /* TIM3 global interrupt */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                              SOME BITS DEFINITIONS                                */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Some bits definitions of DWT control register (DWT_CTRL) */
+#define DWT_CTRL_CYCCNTENA                      0U  /* Cycle counter enable */
+
+/* Some bits definitions of debug exception and monitor control register (DEMCR) */
+#define DEMCR_TRCENA                            24U /* Trace (DWT/ITM) enable */
+
+/* Some bits definitions of interrupt control and state register (SCB_ICSR) */
+#define SCB_ICSR_PENDSVSET                      28U /* PendSV set-pending */
+#define SCB_ICSR_PENDSTSET                      26U /* SysTick set-pending */
+
+/* Priority fields of system handler priority register 3 (SCB_SHPR3) */
+#define SCB_SHPR3_PRI_PENDSV                    16U /* PendSV priority field (bits 23:16) */
+#define SCB_SHPR3_PRI_SYSTICK                   24U /* SysTick priority field (bits 31:24) */
+#define SCB_SHPR3_PRI_MASK                      0xFFUL
+
+/* Some bits definitions of general purpose timer registers (TIM_xxx) */
+#define TIM_CR1_CEN                             0U  /* Counter enable */
+#define TIM_DIER_UIE                            0U  /* Update interrupt enable */
+#define TIM_DIER_CC1IE                          1U  /* Capture/compare 1 interrupt enable */
+#define TIM_SR_UIF                              0U  /* Update interrupt flag */
+#define TIM_SR_CC1IF                            1U  /* Capture/compare 1 interrupt flag */
+#define TIM_EGR_UG                              0U  /* Update generation */
+#define TIM_EGR_CC1G                            1U  /* Capture/compare 1 generation */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  PRIVATE MACROS                                   */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Prevent both compiler and CPU from reordering memory accesses across this point */
+#define OS_MEMORY_BARRIER()					__asm volatile ("DMB" : : : "memory")
+
+/* Atomically swap the value of a 32-bit variable and return its old value (LDREX/STREX) */
+#define OS_ATOMIC_EXCHANGE(Copy_pVar,Copy_Val)	__atomic_exchange_n((Copy_pVar),(Copy_Val),__ATOMIC_SEQ_CST)
+
+/* Save PRIMASK then mask interrupts, and restore the saved PRIMASK (nesting safe) */
+#define OS_ENTER_CRITICAL(Copy_State)		__asm volatile ("MRS %0, PRIMASK\n\tCPSID i" : "=r" (Copy_State) : : "memory")
+#define OS_EXIT_CRITICAL(Copy_State)		__asm volatile ("MSR PRIMASK, %0" : : "r" (Copy_State) : "memory")
+
+/* Read the free running CPU cycle counter */
+#define OS_CYCLE_COUNT()					(DWT->CYCCNT)
+
+/* Convert a duration in microseconds to CPU cycles */
+#define OS_US_TO_CYCLES(Copy_Us)			((Copy_Us) * (OS_CPU_CLOCK_HZ / 1000000UL))
+
+/* Atomically set bits of a 32-bit variable (LDREX/STREX) */
+#define OS_ATOMIC_SET_BITS(Copy_pVar,Copy_Mask)	__atomic_fetch_or((Copy_pVar),(Copy_Mask),__ATOMIC_SEQ_CST)
+
+/* Seqlock sequence is odd while a writer is updating the protected data */
+#define OS_SEQLOCK_WRITE_IN_PROGRESS		0x00000001U
+
+/* Triple buffer state word layout: index of the middle buffer plus a new data flag */
+#define OS_TRIPLE_BUFFER_INDEX_MASK			0x00000003U
+#define OS_TRIPLE_BUFFER_NEW_DATA			0x00000004U
+
+/* Lowest exception priority (4 priority bits on STM32F1), shared by SysTick and PendSV so that passes never preempt each other */
+#define OS_KERNEL_INTERRUPT_PRIORITY		0xF0UL
+
+/* Request a PendSV exception, the event pass runs once no higher priority handler is active */
+#define OS_PEND_DISPATCH()					(SCB_ICSR = (1UL << SCB_ICSR_PENDSVSET))
+
+/* Number of bits of an NVIC priority byte not implemented on STM32F1 */
+#define OS_NVIC_PRIORITY_SHIFT				4U
+
+/* Read/write the base priority mask, BASEPRI_MAX only ever raises the masking level */
+#define OS_READ_BASEPRI(Copy_Value)			__asm volatile ("MRS %0, BASEPRI" : "=r" (Copy_Value) : : "memory")
+#define OS_WRITE_BASEPRI(Copy_Value)		__asm volatile ("MSR BASEPRI, %0" : : "r" (Copy_Value) : "memory")
+#define OS_RAISE_BASEPRI(Copy_Value)		__asm volatile ("MSR BASEPRI_MAX, %0" : : "r" (Copy_Value) : "memory")
+
+/* Read the current stack pointer */
+#define OS_READ_SP(Copy_Value)				__asm volatile ("MOV %0, sp" : "=r" (Copy_Value))
+
+/* Word written over the unused stack, a stack word not holding it has been used */
+#define OS_STACK_PAINT_PATTERN				0xA5A5A5A5UL
+
+/* Unused peripheral IRQs (CAN RX1, CAN SCE, I2C2 EV/ER, SPI2, USART3, TAMPER, FLASH) lent to tasks 0 --> 7 in OS_PREEMPTIVE_SRP mode */
+#define OS_SRP_TASK_IRQS					{21U, 22U, 33U, 34U, 36U, 39U, 2U, 4U}
+#define OS_SRP_MAX_TASKS					8U
+
+/* Mask with one bit set per task slot in the system */
+#define OS_ALL_TASKS_MASK					(0xFFFFFFFFUL >> (32U - NUM_OF_TASKS))
+
+/* Marks a task that is not a stage of any chain */
+#define OS_CHAIN_NONE						0xFFU
+
+/* Wait for interrupt, sleep the CPU until the next interrupt */
+#define OS_WAIT_FOR_INTERRUPT()				__asm volatile ("WFI" : : : "memory")
+
+/* Start address of the flash memory holding the program image */
+#define OS_FLASH_BASE_ADDRESS				0x08000000UL
+
+/* Largest task budget, deadlines are compared as signed 16-bit distances from the budget timer count */
+#define OS_BUDGET_MAX_US					32767U
+
+/* Word index of the return address in the exception frame stacked on exception entry (R0-R3, R12, LR, PC, xPSR) */
+#define OS_EXCEPTION_FRAME_PC				6U
+
+/* Largest sample count of a profiler bucket, sampling stops once a bucket reaches it */
+#define OS_PROFILER_BUCKET_MAX				0xFFFFU
+
+/* Function trace record layout: entry flag, function address offset from the flash start and cycles since the previous record */
+#define OS_TRACE_ENTRY						0x00000001UL
+#define OS_TRACE_FUNCTION_MASK				0x000FFFFEUL
+#define OS_TRACE_DELTA_SHIFT				20U
+#define OS_TRACE_DELTA_MAX					0x00000FFFUL
+#define OS_TRACE_LONG_DELTA_SHIFT			12U
+
+/* Latency sources measured by the OS itself, the others are recorded by the application */
+#define OS_LATENCY_NUM_OF_OS_SOURCES		2U
+
+/* Binary log record layout: header word (format string ID and number of arguments), cycle count, then the arguments */
+#define OS_LOG_ID_SHIFT						16U
+#define OS_LOG_NUM_OF_ARGS_MASK				0x000000FFUL
+#define OS_LOG_RECORD_HEADER_WORDS			2U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            CONFIGURATION OPTIONS VALUES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Scheduling mode options */
+#define OS_COOPERATIVE		 0U
+#define OS_PREEMPTIVE_SRP	 1U
+
+/* Budget overrun action options */
+#define OS_BUDGET_NOTIFY	 0U
+#define OS_BUDGET_SUSPEND	 1U
+#define OS_BUDGET_DEMOTE	 2U
+
+/* Partition scheduling policy options */
+#define OS_PARTITION_PRIORITY	 0U
+#define OS_PARTITION_ROUND_ROBIN 1U
+
+/* Binary log level options */
+#define OS_LOG_LEVEL_ERROR	 1U
+#define OS_LOG_LEVEL_WARNING 2U
+#define OS_LOG_LEVEL_INFO	 3U
+#define OS_LOG_LEVEL_DEBUG	 4U
+
+/* Enable/Disable option values */
+#define DISABLE				 0U
+#define ENABLE				 1U
+
+#endif /* OS_PRIVATE_H_ */
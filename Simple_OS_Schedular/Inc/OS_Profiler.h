@@ -0,0 +1,138 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Profiler                  */
+/*     			    Description	 : OS Profiler Header File      */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_PROFILER_H_
+#define OS_PROFILER_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_PROFILER enabled TIM3 interrupts OS_PROFILER_SAMPLE_RATE_HZ times per second at the  */
+/*            highest NVIC priority. Its handler reads the return address stacked on exception entry, the  */
+/*            instruction the CPU was executing, and counts it in the bucket of its code address range.    */
+/*            Task code needs no instrumentation and the cost is one short interrupt per sample.           */
+/*                                                                                                         */
+/*  Note(2) : Bucket n counts addresses from OS_FLASH_BASE_ADDRESS + n * 2^OS_PROFILER_BUCKET_SHIFT, the   */
+/*            samples out of the buckets range (code executed from RAM) are only counted. Sampling stops   */
+/*            by itself once a bucket is full so the profile always stays consistent.                      */
+/*                                                                                                         */
+/*  Note(3) : Samples cannot be taken while interrupts are masked (OS_ENTER_CRITICAL), they are taken as   */
+/*            soon as the critical section ends and are charged to the code right after it.                */
+/*                                                                                                         */
+/*  Note(4) : Global_ProfilerData holds everything needed to symbolise the profile, dump it from the       */
+/*            debugger (gdb: dump binary value profile.bin Global_ProfilerData) then run                   */
+/*            Tools/profile_report.py Simple_OS_Schedular.elf profile.bin for the flat per-function        */
+/*            profile.                                                                                     */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t BaseAddress;								/* Code address of the start of bucket 0 */
+	uint32_t BucketShift;								/* Bucket size as a power of 2 */
+	uint32_t NumOfBuckets;								/* Number of buckets */
+	volatile uint32_t SamplesCount;						/* Number of samples taken */
+	volatile uint32_t OutOfRangeCount;					/* Number of samples out of the buckets range */
+	volatile uint16_t BucketsArr[OS_PROFILER_NUM_OF_BUCKETS];	/* Samples count of every code address range */
+}OS_Profile_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerInit                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets up the sampling timer and its interrupt and starts        */
+/*                 sampling, called by OS_Init when OS_PROFILER is enabled        */
+/*--------------------------------------------------------------------------------*/
+void OS_ProfilerInit(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerStart                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes sampling, the samples taken so far are kept            */
+/*--------------------------------------------------------------------------------*/
+void OS_ProfilerStart(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerStop                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stops sampling, so that the profile of one phase of the        */
+/*                 application can be read                                        */
+/*--------------------------------------------------------------------------------*/
+void OS_ProfilerStop(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerReset                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Clears every sample count, sampling is left stopped            */
+/*--------------------------------------------------------------------------------*/
+void OS_ProfilerReset(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerGetBucket                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint16_t Copy_BucketIndex                                      */
+/*                 Brief: Index of the bucket                                     */
+/*                 Range: (0 --> OS_PROFILER_NUM_OF_BUCKETS - 1)                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pAddress                                        */
+/*                 Brief: Code address of the start of the bucket                 */
+/*                 -------------------------------------------------------------- */
+/*                 uint16_t* Copy_pCount                                          */
+/*                 Brief: Number of samples counted in the bucket                 */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets one bucket of the profile, so that the application can    */
+/*                 stream it out without a debugger                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ProfilerGetBucket(uint16_t Copy_BucketIndex, uint32_t* Copy_pAddress, uint16_t* Copy_pCount);
+
+#endif /* OS_PROFILER_H_ */
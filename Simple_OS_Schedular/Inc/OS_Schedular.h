@@ -16,19 +16,82 @@
 /*-----------------------------------------------------------------------------------*/
 typedef struct
 {
-	uint8_t TaskPeriodicity;
-	void (*PointerToFunction) (void);
+	void (*pFunction) (void);			/* Task function */
+	uint8_t Priority;					/* Task priority (index in the task table) */
+	uint8_t Periodicity;				/* Task periodicity in OS ticks (0 for a task only released on demand) */
+	uint8_t Offset;						/* Ticks added before the first release to spread tasks of the same period */
+}OS_TaskDescriptor_t;
+
+typedef struct
+{
+	const OS_TaskDescriptor_t* pDescriptor;	/* Constant part of the task, in the .os_tasks flash section for DEFINE_TASK tasks (NULL if free or self-timed) */
+	uint8_t TaskPeriodicity;			/* Current periodicity in OS ticks, taken from the descriptor and changed at run time */
+	uint8_t TaskState;					/* OS_TASK_DELETED, OS_TASK_ACTIVE or OS_TASK_SUSPENDED */
+	uint32_t NextRelease;				/* OS tick of the next periodic release of the task */
+	uint32_t SuccessorsMask;			/* Tasks released as soon as this task completes (bit number = task priority) */
+	uint32_t MinInterArrival;			/* Minimum time between two event activations in CPU cycles (0 for no limit) */
+	uint32_t LastActivation;			/* Cycle count of the last accepted event activation */
+	uint32_t (*PointerToSelfTimedFunction) (void);	/* Self-timed task function returning OS ticks until its next release (NULL otherwise) */
 }Task_t;
 
+typedef struct
+{
+	Task_t* pTasksArr;					/* Task table of the schedular (index = task priority) */
+	uint8_t NumOfTasks;					/* Number of task slots in the table (32 at most) */
+	uint8_t Policy;						/* OS_INSTANCE_PRIORITY or OS_INSTANCE_ROUND_ROBIN */
+	uint8_t RoundRobinNext;				/* First task tried by the next round robin dispatch */
+	volatile uint32_t TickCounter;		/* Schedular passes so far */
+	volatile uint32_t ReleaseMask;		/* One bit per task released on demand or by an event (bit number = task priority) */
+	volatile uint32_t ActiveMask;		/* One bit per registered task that is not suspended */
+	volatile uint32_t PeriodicMask;		/* One bit per active task with non zero periodicity */
+	volatile uint32_t SelfTimedWaitingMask;	/* One bit per self-timed task waiting for the delay it returned */
+	volatile uint32_t DeferredMask;		/* One bit per task with an event activation deferred by its minimum inter-arrival time */
+}OS_Schedular_t;
+
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                                     MACROS		  		                         */
 /*                                                                                   */
 /*-----------------------------------------------------------------------------------*/
-/* Define number of tasks in the system */
+/* Define number of tasks in the system (32 at most, one bit per task in release masks) */
 #define NUM_OF_TASKS					3U
 
+/*
+ * Define number of tasks created at run time through TASKS_CREATION, chain stages and active
+ * objects included (their descriptors are kept in RAM), 0 if every task is defined with DEFINE_TASK,
+ * TASKS_CREATION creates no task once they are all taken
+ */
+#define NUM_OF_CREATED_TASKS			0U
+
+/* Task states */
+#define OS_TASK_DELETED					0U	/* Task slot is free */
+#define OS_TASK_ACTIVE					1U	/* Task is released periodically and on demand */
+#define OS_TASK_SUSPENDED				2U	/* Task keeps its slot but is never released until resumed */
+
+/*
+ * Define a task at file scope, its constant descriptor is placed in the .os_tasks flash section
+ * and OS_Init registers it, so no TASKS_CREATION call is needed (first release at tick ==
+ * Copy_Offset + Copy_Periodicity), the task table references it and keeps only mutable state
+ */
+#define DEFINE_TASK(Copy_Function,Copy_Priority,Copy_Periodicity,Copy_Offset)										\
+		void Copy_Function(void);																				\
+		const OS_TaskDescriptor_t OS_TaskDescriptor_##Copy_Function												\
+		__attribute__((section(".os_tasks"), used, aligned(4))) = {Copy_Function, (Copy_Priority), (Copy_Periodicity), (Copy_Offset)}
+
+/* Returned by a self-timed task to be released only through OS_ReleaseTask or OS_TaskActivate */
+#define OS_WAIT_FOR_EVENT				0xFFFFFFFFUL
+
+/* Longest self-timed delay in OS ticks, releases are due once the signed tick distance is not negative so longer delays are cut to it */
+#define OS_MAX_SELF_TIMED_DELAY			0x7FFFFFFFUL
+
+/* Returned by OS_GetRunningTask when no task is being executed */
+#define OS_NO_TASK						0xFFU
+
+/* Schedular dispatch policies */
+#define OS_INSTANCE_PRIORITY			0U	/* Ready tasks run in priority order */
+#define OS_INSTANCE_ROUND_ROBIN			1U	/* Ready tasks run in turn starting after the last one served */
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                                 FUNCTIONS PROTOTYPES		  		                 */
@@ -59,7 +122,8 @@ void OS_Init(void);
 /* 				   -------------------------------------------------------------- */
 /* 				   uint8_t Copy_Periodicity                                       */
 /* 				   Brief: Periodicity of the task to be created (How much time it */
-/*                        takes this task to be ready)                            */
+/*                        takes this task to be ready), 0 for a task that only    */
+/*                        runs when released through OS_ReleaseTask               */
 /*  			   -------------------------------------------------------------- */
 /* 				   void(*Copy_Fptr)(void)                                         */
 /* 				   Brief: Pointer to function of the task that will be executed   */
@@ -76,19 +140,473 @@ void OS_Init(void);
 void TASKS_CREATION(uint8_t Copy_Priority,uint8_t Copy_Periodicity, void(*Copy_Fptr)(void));
 
 /*--------------------------------------------------------------------------------*/
-/* @Function Name: SCHEDULAR          					                          */
+/* @Function Name: OS_TaskCreateSelfTimed                                         */
 /*--------------------------------------------------------------------------------*/
-/* @Param(in)	 : None				                                              */
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be created                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t(*Copy_Fptr)(void)                                     */
+/*                 Brief: Task function, returns the OS ticks until its next      */
+/*                        release (0 is taken as 1) or OS_WAIT_FOR_EVENT          */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_FirstDelay                                       */
+/*                 Brief: OS ticks until the first release or OS_WAIT_FOR_EVENT   */
+/*                 Range: (0 --> OS_MAX_SELF_TIMED_DELAY), longer ones are cut    */
 /*--------------------------------------------------------------------------------*/
-/* @Param(inout) : None                                                	          */
+/* @Param(inout) : None                                                           */
 /*--------------------------------------------------------------------------------*/
-/* @Param(out)	 : None                                            	              */
+/* @Param(out)   : None                                                           */
 /*--------------------------------------------------------------------------------*/
-/* @Return		 : void                                          				  */
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task with a variable period: each run sets the time  */
+/*                 of its next release, so every dispatch does real work (it can  */
+/*                 still be released on demand or by events at any time)          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskCreateSelfTimed(uint8_t Copy_Priority, uint32_t (*Copy_Fptr)(void), uint32_t Copy_FirstDelay);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ReleaseTask                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be released                     */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Releases a task once on the next schedular pass regardless of  */
+/*                 its periodicity, safe to be called from tasks and ISRs         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ReleaseTask(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskActivate                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be activated by an event        */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (BUSY_FUNC if the event came before minimum     */
+/*                 inter-arrival time of the task and was deferred)               */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Activates a task on an event (interrupt, queue, flag) without  */
+/*                 waiting for the next tick, the task is run by an event pass    */
+/*                 (PendSV) in priority order with other ready tasks. Events      */
+/*                 closer than the minimum inter-arrival time of the task are     */
+/*                 merged into one activation served by the first tick or event   */
+/*                 pass after that time elapsed (rounded up to the next tick if   */
+/*                 no other event comes)                                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskActivate(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetMinInterArrival                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_MinInterArrivalUs                                */
+/*                 Brief: Minimum time between two event activations in us, 0 for */
+/*                        no limit                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the minimum inter-arrival time protecting the CPU from    */
+/*                 event storms on an event activated task                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetMinInterArrival(uint8_t Copy_Priority, uint32_t Copy_MinInterArrivalUs);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSuspend                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be suspended                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stops releasing a task (periodically and on demand) until it   */
+/*                 is resumed, a suspended task costs nothing in the tick path    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSuspend(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskResume                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be resumed                      */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes a suspended task, its next release is the next one on  */
+/*                 its original release grid so its phase is kept                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskResume(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskChangePeriod                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: New periodicity of the task in OS ticks, 0 for a task   */
+/*                        that only runs when released through OS_ReleaseTask     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Changes the periodicity of a task, the already planned next    */
+/*                 release is kept and the new periodicity is counted from it     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskChangePeriod(uint8_t Copy_Priority, uint8_t Copy_Periodicity);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskDelete                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be deleted                      */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Removes a task from the system and frees its priority slot     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskDelete(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskGetState                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint8_t* Copy_pState                                           */
+/*                 Brief: State of the task (OS_TASK_xxx)                         */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the current state of a task                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskGetState(uint8_t Copy_Priority, uint8_t* Copy_pState);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetSuccessors                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the predecessor task                        */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_SuccessorsMask                                   */
+/*                 Brief: One bit per task to be released once the predecessor    */
+/*                        completes (bit number = task priority), 0 for none      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the tasks released in the same schedular pass right after */
+/*                 a task completes, whatever their priorities (RT_NOK if they    */
+/*                 lead back to the task)                                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetSuccessors(uint8_t Copy_Priority, uint32_t Copy_SuccessorsMask);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_GetRunningTask                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns priority of the task being executed, or OS_NO_TASK     */
+/*                 when called outside of a task                                  */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_GetRunningTask(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_GetTickCount                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns the number of OS ticks (schedular passes) since the    */
+/*                 OS was started                                                 */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_GetTickCount(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_GetCycleCount                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns the free running CPU cycle counter, differences of two */
+/*                 readings give cycle accurate durations (wraps every 2^32       */
+/*                 cycles)                                                        */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_GetCycleCount(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_GetDispatchCycles                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pLastCycles                                     */
+/*                 Brief: CPU cycles spent in the last tick pass                  */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pMaxCycles                                      */
+/*                 Brief: CPU cycles spent in the longest tick pass (may be NULL) */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the cost of the tick pass including the tasks it ran, to  */
+/*                 compare the static and the table driven schedular              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_GetDispatchCycles(uint32_t* Copy_pLastCycles, uint32_t* Copy_pMaxCycles);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ExecuteTask                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be executed                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t (successors released by the task)                     */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs a task if it is still active, used by the dispatcher and  */
+/*                 the OS_PREEMPTIVE_SRP task handlers (not for application use)  */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_ExecuteTask(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SCHEDULAR                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular whose clock source ticked                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Scheduler to manage tasks according to periodicity and         */
+/*                 priority: counts the tick, releases the due periodic and       */
+/*                 self-timed tasks and dispatches them with the pending on       */
+/*                 demand releases (the default schedular is passed by SysTick)   */
+/*--------------------------------------------------------------------------------*/
+void SCHEDULAR(OS_Schedular_t* Copy_pSchedular);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskRegister                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_TaskDescriptor_t* Copy_pDescriptor                    */
+/*                 Brief: Descriptor of the task to be created, kept referenced   */
+/*                        by the task table                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Fills the runtime state of a task and makes it active,         */
+/*                 first released one period plus offset from now                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskRegister(OS_Schedular_t* Copy_pSchedular, const OS_TaskDescriptor_t* Copy_pDescriptor);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskCreateSelfTimed                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be created                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t(*Copy_Fptr)(void)                                     */
+/*                 Brief: Task function, returns the ticks until its next         */
+/*                        release (0 is taken as 1) or OS_WAIT_FOR_EVENT          */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_FirstDelay                                       */
+/*                 Brief: Ticks until the first release or OS_WAIT_FOR_EVENT      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task with a variable period, each run sets the       */
+/*                 time of its next release                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskCreateSelfTimed(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority, uint32_t (*Copy_Fptr)(void), uint32_t Copy_FirstDelay);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularReleaseTask                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be released                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Releases a task once on the next pass of its schedular,        */
+/*                 safe to be called from tasks and ISRs                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularReleaseTask(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskSuspend                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be suspended                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stops releasing a task (periodically and on demand) until      */
+/*                 it is resumed                                                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskSuspend(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskResume                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be resumed                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes a suspended task on its original release grid          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskResume(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskChangePeriod                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: New periodicity of the task in ticks, 0 for a task      */
+/*                        that only runs when released on demand                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Changes the periodicity of a task from its already planned     */
+/*                 next release                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskChangePeriod(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority, uint8_t Copy_Periodicity);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskDelete                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be deleted                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Removes a task from its schedular and frees its slot           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskDelete(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskSetSuccessors                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the predecessor task                        */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_SuccessorsMask                                   */
+/*                 Brief: One bit per task to be released once the predecessor    */
+/*                        completes (bit number = task priority), 0 for none      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : Scheduler to manage tasks according to periodicity and         */
-/* 				   priority        												  */
+/* @Description  : Sets the tasks released in the same pass right after a         */
+/*                 task completes, successors leading back to the task (cycles)   */
+/*                 are rejected                                                   */
 /*--------------------------------------------------------------------------------*/
-void SCHEDULAR(void);
+ERROR_STATUS_t OS_SchedularTaskSetSuccessors(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority, uint32_t Copy_SuccessorsMask);
 
 #endif /* OS_SCHEDULAR_H_ */
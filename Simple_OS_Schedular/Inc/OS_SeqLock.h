@@ -0,0 +1,262 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS SeqLock                   */
+/*     			    Description	 : OS SeqLock Header File       */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_SEQLOCK_H_
+#define OS_SEQLOCK_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : Both primitives below are meant for data written by exactly one writer (typically an ISR)    */
+/*            and read by code running at a lower priority (tasks or the idle loop). Neither the writer    */
+/*            nor the readers mask interrupts.                                                             */
+/*                                                                                                         */
+/*  Note(2) : Seqlock : the writer never waits, readers copy the data and retry when a write overlapped    */
+/*            their copy. A reader must never preempt the writer of the same seqlock or it would see the   */
+/*            write in progress on every retry.                                                            */
+/*                                                                                                         */
+/*  Note(3) : Triple buffer : the writer fills a private buffer and swaps it with the middle one, the      */
+/*            reader swaps the middle one with its own buffer only when new data was published. Nobody     */
+/*            copies or retries, so it fits data too big to be copied on every read.                       */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	volatile uint32_t Sequence;					/* Even when data is stable, odd while a write is in progress */
+}OS_SeqLock_t;
+
+typedef struct
+{
+	void* pBuffers[3];							/* The three user supplied buffers */
+	volatile uint32_t State;					/* Index of the middle buffer and new data flag */
+	uint8_t WriteIndex;							/* Index of the buffer owned by the writer */
+	uint8_t ReadIndex;							/* Index of the buffer owned by the reader */
+}OS_TripleBuffer_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockInit                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_SeqLock_t* Copy_pSeqLock                                    */
+/*                 Brief: Pointer to the seqlock to be initialized                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Initializes a seqlock to the stable (even) state               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SeqLockInit(OS_SeqLock_t* Copy_pSeqLock);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockWriteBegin                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_SeqLock_t* Copy_pSeqLock                                    */
+/*                 Brief: Pointer to the seqlock protecting the data to be        */
+/*                        updated in place                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Marks the start of an in place update of the protected data,   */
+/*                 must be paired with OS_SeqLockWriteEnd                         */
+/*--------------------------------------------------------------------------------*/
+void OS_SeqLockWriteBegin(OS_SeqLock_t* Copy_pSeqLock);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockWriteEnd                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_SeqLock_t* Copy_pSeqLock                                    */
+/*                 Brief: Pointer to the seqlock protecting the updated data      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Marks the end of an in place update of the protected data      */
+/*--------------------------------------------------------------------------------*/
+void OS_SeqLockWriteEnd(OS_SeqLock_t* Copy_pSeqLock);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockReadBegin                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_SeqLock_t* Copy_pSeqLock                              */
+/*                 Brief: Pointer to the seqlock protecting the data to be read   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Samples the sequence before reading the protected data in      */
+/*                 place, the returned value is passed to OS_SeqLockReadRetry     */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_SeqLockReadBegin(const OS_SeqLock_t* Copy_pSeqLock);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockReadRetry                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_SeqLock_t* Copy_pSeqLock                              */
+/*                 Brief: Pointer to the seqlock protecting the data just read    */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Sequence                                         */
+/*                 Brief: Sequence returned by OS_SeqLockReadBegin                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t (1 if the read was torn and must be retried, else 0)   */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Checks whether a writer touched the data while it was read     */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_SeqLockReadRetry(const OS_SeqLock_t* Copy_pSeqLock, uint32_t Copy_Sequence);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockWrite                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const void* Copy_pData                                         */
+/*                 Brief: Pointer to the new value to be published                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Size                                             */
+/*                 Brief: Size of the protected data in bytes                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_SeqLock_t* Copy_pSeqLock                                    */
+/*                 Brief: Pointer to the seqlock protecting the shared data       */
+/*                 -------------------------------------------------------------- */
+/*                 void* Copy_pShared                                             */
+/*                 Brief: Pointer to the shared data to be overwritten            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Copies a new value into the shared data, never blocks and its  */
+/*                 cost only depends on Copy_Size                                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SeqLockWrite(OS_SeqLock_t* Copy_pSeqLock, void* Copy_pShared, const void* Copy_pData, uint32_t Copy_Size);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockRead                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_SeqLock_t* Copy_pSeqLock                              */
+/*                 Brief: Pointer to the seqlock protecting the shared data       */
+/*                 -------------------------------------------------------------- */
+/*                 const void* Copy_pShared                                       */
+/*                 Brief: Pointer to the shared data to be read                   */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Size                                             */
+/*                 Brief: Size of the protected data in bytes                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : void* Copy_pData                                               */
+/*                 Brief: Pointer to where the consistent snapshot is copied      */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pVersion                                        */
+/*                 Brief: Number of writes the snapshot reflects (may be NULL)    */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Copies a consistent snapshot of the shared data, retrying up   */
+/*                 to OS_SEQLOCK_MAX_RETRIES times when a write tears the copy    */
+/*                 and returning BUSY_FUNC if every attempt was torn              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SeqLockRead(const OS_SeqLock_t* Copy_pSeqLock, const void* Copy_pShared, void* Copy_pData, uint32_t Copy_Size, uint32_t* Copy_pVersion);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TripleBufferInit                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void* Copy_pBuffer0, void* Copy_pBuffer1, void* Copy_pBuffer2  */
+/*                 Brief: Three buffers of the same type to rotate between the    */
+/*                        writer and the reader                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_TripleBuffer_t* Copy_pTripleBuffer                          */
+/*                 Brief: Pointer to the triple buffer to be initialized          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Initializes a triple buffer over three user supplied buffers   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TripleBufferInit(OS_TripleBuffer_t* Copy_pTripleBuffer, void* Copy_pBuffer0, void* Copy_pBuffer1, void* Copy_pBuffer2);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TripleBufferGetWriteBuffer                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_TripleBuffer_t* Copy_pTripleBuffer                    */
+/*                 Brief: Pointer to the triple buffer                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void* (buffer the writer may fill)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns the buffer owned by the writer, it stays private to    */
+/*                 the writer until OS_TripleBufferPublish is called              */
+/*--------------------------------------------------------------------------------*/
+void* OS_TripleBufferGetWriteBuffer(const OS_TripleBuffer_t* Copy_pTripleBuffer);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TripleBufferPublish                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_TripleBuffer_t* Copy_pTripleBuffer                          */
+/*                 Brief: Pointer to the triple buffer                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Publishes the filled write buffer as the latest value through  */
+/*                 a single atomic swap with the middle buffer                    */
+/*--------------------------------------------------------------------------------*/
+void OS_TripleBufferPublish(OS_TripleBuffer_t* Copy_pTripleBuffer);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TripleBufferGetReadBuffer                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_TripleBuffer_t* Copy_pTripleBuffer                          */
+/*                 Brief: Pointer to the triple buffer                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint8_t* Copy_pNewData                                         */
+/*                 Brief: Set to 1 if a new value was published since the last    */
+/*                        call, else 0 (may be NULL)                              */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : const void* (buffer holding the latest published value)        */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns the latest published value, swapping buffers with the  */
+/*                 writer only when new data is available. The returned buffer    */
+/*                 stays valid until the next call                                */
+/*--------------------------------------------------------------------------------*/
+const void* OS_TripleBufferGetReadBuffer(OS_TripleBuffer_t* Copy_pTripleBuffer, uint8_t* Copy_pNewData);
+
+#endif /* OS_SEQLOCK_H_ */
@@ -0,0 +1,118 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Server                    */
+/*     			    Description	 : OS Server Header File        */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_SERVER_H_
+#define OS_SERVER_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : The job server is a deferrable server: a task registered at a chosen priority that runs      */
+/*            aperiodic jobs (command handling, fault logging, ...) out of a FIFO queue as long as it has  */
+/*            budget left. Its budget is refilled every replenishment period.                              */
+/*                                                                                                         */
+/*  Note(2) : Posting a job activates the server through an event pass (OS_TaskActivate) when budget is    */
+/*            left, so aperiodic jobs are served right away instead of waiting for the next tick. Once the */
+/*            budget is used up, the remaining jobs wait for the next replenishment, so the server never   */
+/*            takes more than budget/period of the CPU and periodic tasks keep their guarantees.           */
+/*                                                                                                         */
+/*  Note(3) : Jobs run to completion, a job started with some budget left may overrun it. The overrun is   */
+/*            taken out of the next replenishment.                                                         */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	void (*pJobFunction) (uint32_t);			/* Job function to be executed */
+	uint32_t Argument;							/* Argument passed to the job function */
+	uint32_t PostTime;							/* Cycle count when the job was posted */
+}OS_Job_t;
+
+typedef struct
+{
+	uint32_t JobsServed;						/* Number of jobs executed so far */
+	uint32_t JobsDropped;						/* Number of jobs rejected because the queue was full */
+	uint32_t LastResponseTime;					/* Post to completion time of the last job in cycles */
+	uint32_t MaxResponseTime;					/* Worst post to completion time so far in cycles */
+	sint32_t Budget;							/* Budget left in the current period in cycles */
+}OS_ServerStats_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ServerInit                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the server task                             */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_BudgetUs                                         */
+/*                 Brief: Execution time the server may use every period in us    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_ReplenishmentPeriod                               */
+/*                 Brief: Budget replenishment period in OS ticks                 */
+/*                 Range: (1 --> 255)                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates the server task with a full budget and an empty queue, */
+/*                 must be called before OS_Init like TASKS_CREATION              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ServerInit(uint8_t Copy_Priority, uint32_t Copy_BudgetUs, uint8_t Copy_ReplenishmentPeriod);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ServerPostJob                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void (*Copy_pJobFunction)(uint32_t)                            */
+/*                 Brief: Job function to be executed by the server               */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Argument                                         */
+/*                 Brief: Argument passed to the job function                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (BUSY_FUNC if the queue is full)                */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Queues an aperiodic job and activates the server through an   */
+/*                 event pass if it has budget left, safe to be called from tasks */
+/*                 and ISRs                                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ServerPostJob(void (*Copy_pJobFunction)(uint32_t), uint32_t Copy_Argument);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ServerGetStats                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_ServerStats_t* Copy_pStats                                  */
+/*                 Brief: Pointer to where the server statistics are copied       */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets served/dropped job counts, job response times and the     */
+/*                 budget left in the current period                              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ServerGetStats(OS_ServerStats_t* Copy_pStats);
+
+#endif /* OS_SERVER_H_ */
@@ -0,0 +1,145 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Srp                       */
+/*     			    Description	 : OS Srp Header File           */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_SRP_H_
+#define OS_SRP_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : In OS_PREEMPTIVE_SRP mode every task priority is mapped to the NVIC IRQ of an unused         */
+/*            peripheral (OS_SRP_TASK_IRQS) at NVIC level (OS_SRP_HIGHEST_TASK_LEVEL + task priority).     */
+/*            Releasing a task pends its IRQ, so the NVIC itself preempts lower priority tasks and runs    */
+/*            them back once the higher one returns, all on the one main stack. Tasks stay plain run to    */
+/*            completion functions.                                                                        */
+/*                                                                                                         */
+/*  Note(2) : Data shared between tasks is protected by a resource. Its ceiling is the NVIC level of the   */
+/*            highest priority task using it, locking raises BASEPRI to the ceiling so no other user of    */
+/*            the resource can start meanwhile (Stack Resource Policy: a task once started never blocks).  */
+/*                                                                                                         */
+/*  Note(3) : In OS_COOPERATIVE mode tasks never preempt each other, locking and unlocking cost nothing    */
+/*            and application code keeps working unchanged in both modes.                                  */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpInit                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the NVIC level of the IRQ of every task and enables it,   */
+/*                 called by OS_Init in OS_PREEMPTIVE_SRP mode                    */
+/*--------------------------------------------------------------------------------*/
+void OS_SrpInit(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpPendTasks                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_ReadyTasks                                       */
+/*                 Brief: One bit per task to be run (bit number = task priority) */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Pends the IRQs of the passed tasks, the NVIC runs them in      */
+/*                 priority order                                                 */
+/*--------------------------------------------------------------------------------*/
+void OS_SrpPendTasks(uint32_t Copy_ReadyTasks);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpSetTaskLevel                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Level                                             */
+/*                 Brief: NVIC level given to the IRQ of the task                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Changes the NVIC level of a task, the level of a running task  */
+/*                 takes effect right away (used to demote a task over budget)    */
+/*--------------------------------------------------------------------------------*/
+void OS_SrpSetTaskLevel(uint8_t Copy_Priority, uint8_t Copy_Level);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpResourceCreate                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_ResourceId                                        */
+/*                 Brief: Index of the resource                                   */
+/*                 Range: (0 --> OS_NUM_OF_RESOURCES - 1)                         */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_UsersMask                                        */
+/*                 Brief: One bit per task using the resource (bit number = task  */
+/*                        priority)                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a resource and computes its ceiling from its users     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SrpResourceCreate(uint8_t Copy_ResourceId, uint32_t Copy_UsersMask);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpResourceLock                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_ResourceId                                        */
+/*                 Brief: Index of the resource to be locked                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pPreviousCeiling                                */
+/*                 Brief: System ceiling before the lock, to be passed back to    */
+/*                        OS_SrpResourceUnlock                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Locks a resource by raising the system ceiling to its ceiling, */
+/*                 locks nest and are released in reverse order                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SrpResourceLock(uint8_t Copy_ResourceId, uint32_t* Copy_pPreviousCeiling);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpResourceUnlock                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_PreviousCeiling                                  */
+/*                 Brief: System ceiling returned by the matching lock            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Unlocks a resource by restoring the system ceiling, tasks held */
+/*                 back by the lock start right away                              */
+/*--------------------------------------------------------------------------------*/
+void OS_SrpResourceUnlock(uint32_t Copy_PreviousCeiling);
+
+#endif /* OS_SRP_H_ */
@@ -0,0 +1,138 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Stack                     */
+/*     			    Description	 : OS Stack Header File         */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_STACK_H_
+#define OS_STACK_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : Tasks, the schedular passes and every interrupt share the one main stack in both scheduling  */
+/*            modes. In OS_PREEMPTIVE_SRP mode a preempting task stacks its frame over the preempted one,  */
+/*            so the peak is the sum of the deepest nesting instead of the deepest single task.            */
+/*                                                                                                         */
+/*  Note(2) : OS_Init paints the unused part of the stack with OS_STACK_PAINT_PATTERN, the peak usage is   */
+/*            found later by looking for the lowest stack word no longer holding that pattern.             */
+/*                                                                                                         */
+/*  Note(3) : OS_StackGetPeakUsage scans the whole main stack on each call. OS_StackScanJob does the same  */
+/*            work as a background job, OS_STACK_SCAN_SLICE words per call, for the main stack (region 0)  */
+/*            and every region registered with OS_StackRegionRegister (a stack of its own given to a task  */
+/*            or to an interrupt driven schedular instance). OS_StackGetHighWaterMark then reads the last  */
+/*            result without scanning. A round only checks the words under the known high-water mark, so   */
+/*            its cost shrinks as the stack is found deeper.                                               */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Stack region painted by OS_Init */
+#define OS_STACK_MAIN					0U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackPaint                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Fills the free stack (from the end of the heap up to the       */
+/*                 current stack pointer) with the paint pattern, called by       */
+/*                 OS_Init                                                        */
+/*--------------------------------------------------------------------------------*/
+void OS_StackPaint(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackGetPeakUsage                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pPeakBytes                                      */
+/*                 Brief: Deepest stack usage seen since OS_Init in bytes         */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pSizeBytes                                      */
+/*                 Brief: Size of the stack region in bytes (may be NULL)         */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the peak usage of the main stack                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_StackGetPeakUsage(uint32_t* Copy_pPeakBytes, uint32_t* Copy_pSizeBytes);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackRegionRegister                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_RegionId                                          */
+/*                 Brief: Index of the region in the stack regions table          */
+/*                 Range: (1 --> OS_NUM_OF_STACK_REGIONS - 1)                     */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_SizeBytes                                        */
+/*                 Brief: Size of the stack in bytes (multiple of 4)              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : uint32_t* Copy_pBase                                           */
+/*                 Brief: Lowest address of the stack (word aligned)              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Paints a stack not in use yet and adds it to the regions       */
+/*                 watched by the stack scan background job                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_StackRegionRegister(uint8_t Copy_RegionId, uint32_t* Copy_pBase, uint32_t Copy_SizeBytes);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackGetHighWaterMark                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_RegionId                                          */
+/*                 Brief: Index of the region (OS_STACK_MAIN for the main stack)  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pPeakBytes                                      */
+/*                 Brief: Deepest usage found by the stack scan job in bytes      */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pSizeBytes                                      */
+/*                 Brief: Size of the region in bytes (may be NULL)               */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the high-water mark of a stack region without scanning it */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_StackGetHighWaterMark(uint8_t Copy_RegionId, uint32_t* Copy_pPeakBytes, uint32_t* Copy_pSizeBytes);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackScanJob                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t (OS_IDLE_JOB_DONE once every region was scanned)       */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Ready made background job checking OS_STACK_SCAN_SLICE stack   */
+/*                 words per call, pass it to OS_IdleJobCreate                    */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_StackScanJob(void);
+
+#endif /* OS_STACK_H_ */
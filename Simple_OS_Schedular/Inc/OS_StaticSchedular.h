@@ -0,0 +1,52 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Static Schedular          */
+/*     			    Description	 : OS Static Schedular Header File */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_STATICSCHEDULAR_H_
+#define OS_STATICSCHEDULAR_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : When the task set is fully known at build time (OS_STATIC_TASK_SET enabled), the tick pass   */
+/*            is generated from OS_STATIC_TASK_LIST: one release test per task with a constant period      */
+/*            (folded by the compiler into no test, a mask or a multiply) and a direct call of the task    */
+/*            function, in priority order. Nothing is loaded from the task table and OS_ExecuteTask is     */
+/*            bypassed, so OS_BUDGET_ENFORCEMENT and OS_LATENCY_HISTOGRAMS are rejected at build time,     */
+/*            OS_LOAD_ACCOUNTING wraps the direct calls itself.                                            */
+/*                                                                                                         */
+/*  Note(2) : The phase counter wraps at OS_STATIC_HYPERPERIOD, the least common multiple of the listed    */
+/*            periods folded at compile time with Euclid's algorithm, so the release pattern repeats       */
+/*            exactly every hyperperiod. A hyperperiod above 32 bits fails the build.                      */
+/*                                                                                                         */
+/*  Note(3) : OS_GetDispatchCycles reports the cost of the tick pass in both the static and the table      */
+/*            driven schedular, to compare them on the same task set.                                      */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StaticSchedular                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Unrolled tick pass of the static task set, called every OS     */
+/*                 tick instead of SCHEDULAR when OS_STATIC_TASK_SET is enabled   */
+/*--------------------------------------------------------------------------------*/
+void OS_StaticSchedular(void);
+
+#endif /* OS_STATICSCHEDULAR_H_ */
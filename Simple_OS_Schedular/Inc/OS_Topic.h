@@ -0,0 +1,163 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Topic                     */
+/*     			    Description	 : OS Topic Header File         */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_TOPIC_H_
+#define OS_TOPIC_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : A topic is a blackboard entry holding only the latest published value of a sensor or a       */
+/*            computed quantity. A producer publishes it once per period and any number of tasks read it.  */
+/*                                                                                                         */
+/*  Note(2) : Each topic is protected by a seqlock, so a read is a plain copy of the value that is only    */
+/*            repeated if a publish tore it. Every publish increments the topic version, so a reader can   */
+/*            tell new values from values it already consumed.                                             */
+/*                                                                                                         */
+/*  Note(3) : Use the OS_TOPIC_xxx macros to pass the size of the value from its type, a size that does    */
+/*            not match the one given at creation is rejected with RT_NOK.                                 */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	OS_SeqLock_t Lock;							/* Seqlock protecting the topic value */
+	uint8_t Size;								/* Size of the topic value in bytes (0 if topic is not created) */
+	uint32_t SubscribersMask;					/* One bit per task activated on publish (bit number = task priority) */
+	uint8_t Value[OS_TOPIC_MAX_SIZE];			/* Latest published value */
+}OS_Topic_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Typed helpers deducing the value size from the passed variable */
+#define OS_TOPIC_CREATE(Copy_TopicId,Copy_Type)					OS_TopicCreate((Copy_TopicId), sizeof(Copy_Type))
+#define OS_TOPIC_PUBLISH(Copy_TopicId,Copy_Value)				OS_TopicPublish((Copy_TopicId), &(Copy_Value), sizeof(Copy_Value))
+#define OS_TOPIC_READ(Copy_TopicId,Copy_Value,Copy_pVersion)	OS_TopicRead((Copy_TopicId), &(Copy_Value), sizeof(Copy_Value), (Copy_pVersion))
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicCreate                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic in the topics table                  */
+/*                 Range: (0 --> OS_NUM_OF_TOPICS - 1)                            */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Size                                              */
+/*                 Brief: Size of the topic value in bytes                        */
+/*                 Range: (1 --> OS_TOPIC_MAX_SIZE)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a topic with no subscribers and a zeroed value         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicCreate(uint8_t Copy_TopicId, uint8_t Copy_Size);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicSubscribe                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic to subscribe to                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_TaskPriority                                      */
+/*                 Brief: Priority of the task to be released on every publish    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Makes a task activated by an event pass right after each      */
+/*                 publish of the topic (tasks only reading the topic in their    */
+/*                 own period do not need to subscribe)                           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicSubscribe(uint8_t Copy_TopicId, uint8_t Copy_TaskPriority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicPublish                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic to be published                      */
+/*                 -------------------------------------------------------------- */
+/*                 const void* Copy_pValue                                        */
+/*                 Brief: Pointer to the new value                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Size                                              */
+/*                 Brief: Size of the new value, must match the topic size        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stores the new value of the topic, bumps its version and       */
+/*                 activates its subscribers, safe to be called from ISRs         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicPublish(uint8_t Copy_TopicId, const void* Copy_pValue, uint8_t Copy_Size);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicRead                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic to be read                           */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Size                                              */
+/*                 Brief: Size of the value buffer, must match the topic size     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : void* Copy_pValue                                              */
+/*                 Brief: Pointer to where the latest value is copied             */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pVersion                                        */
+/*                 Brief: Version of the copied value, 0 if never published       */
+/*                        (may be NULL)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Copies the latest value of the topic with its version          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicRead(uint8_t Copy_TopicId, void* Copy_pValue, uint8_t Copy_Size, uint32_t* Copy_pVersion);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicGetVersion                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pVersion                                        */
+/*                 Brief: Number of publishes done on the topic so far            */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the topic version without copying its value, so that a    */
+/*                 reader can skip values it already consumed                     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicGetVersion(uint8_t Copy_TopicId, uint32_t* Copy_pVersion);
+
+#endif /* OS_TOPIC_H_ */
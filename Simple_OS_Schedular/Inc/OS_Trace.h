@@ -0,0 +1,138 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Trace                     */
+/*     			    Description	 : OS Trace Header File         */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+#ifndef OS_TRACE_H_
+#define OS_TRACE_H_
+
+/*---------------------------------------------------------------------------------------------------------*/
+/*                                                                                                         */
+/*  Note(1) : With OS_FUNCTION_TRACE enabled every function of the sources built with                      */
+/*            -finstrument-functions calls __cyg_profile_func_enter on entry and __cyg_profile_func_exit   */
+/*            on exit. Only the sources listed in OS_TRACE_SOURCES are built that way, so the overhead     */
+/*            stays in the code under analysis:                                                            */
+/*                                                                                                         */
+/*            make all OS_TRACE_SOURCES="GPIO_Program RCC_Program"      (from Debug/)                      */
+/*                                                                                                         */
+/*  Note(2) : Every entry or exit is one 32-bit record: bit 0 is set on entry, bits 19:1 hold the          */
+/*            function address offset from OS_FLASH_BASE_ADDRESS and bits 31:20 the CPU cycles since the   */
+/*            previous record. A longer time is carried by extra records with bits 19:0 cleared and bits   */
+/*            31:20 holding cycles / 4096, added to the delta of the next record.                          */
+/*                                                                                                         */
+/*  Note(3) : Global_TraceData is a ring buffer overwriting its oldest records, dump it from the debugger  */
+/*            (gdb: dump binary value trace.bin Global_TraceData) then run                                 */
+/*            Tools/trace_flamegraph.py Simple_OS_Schedular.elf trace.bin to get the folded call stacks    */
+/*            read by flamegraph.pl or speedscope.                                                         */
+/*                                                                                                         */
+/*  Note(4) : Traced functions may run before OS_Init, the cycle counter is started by the first record.   */
+/*                                                                                                         */
+/*---------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint32_t BaseAddress;								/* Code address function offsets are taken from */
+	uint32_t NumOfRecords;								/* Number of records of the ring buffer */
+	volatile uint32_t WriteCount;						/* Number of records written so far (next record index modulo the size) */
+	volatile uint32_t RecordsArr[OS_TRACE_NUM_OF_RECORDS];	/* Ring buffer of entry, exit and long delta records */
+}OS_Trace_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 FUNCTIONS PROTOTYPES                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TraceStart                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes recording, tracing is running from reset               */
+/*--------------------------------------------------------------------------------*/
+void OS_TraceStart(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TraceStop                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Freezes the ring buffer, so that the records leading to an     */
+/*                 event of interest are not overwritten before being dumped      */
+/*--------------------------------------------------------------------------------*/
+void OS_TraceStop(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TraceReset                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Discards every record, recording goes on if it was running     */
+/*--------------------------------------------------------------------------------*/
+void OS_TraceReset(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: __cyg_profile_func_enter                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void* Copy_pFunction                                           */
+/*                 Brief: Address of the entered function                         */
+/*                 -------------------------------------------------------------- */
+/*                 void* Copy_pCallSite                                           */
+/*                 Brief: Return address of the call (not recorded)               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records a function entry, called by instrumented code only     */
+/*--------------------------------------------------------------------------------*/
+void __cyg_profile_func_enter(void* Copy_pFunction, void* Copy_pCallSite) __attribute__((no_instrument_function));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: __cyg_profile_func_exit                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void* Copy_pFunction                                           */
+/*                 Brief: Address of the returning function                       */
+/*                 -------------------------------------------------------------- */
+/*                 void* Copy_pCallSite                                           */
+/*                 Brief: Return address of the call (not recorded)               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records a function exit, called by instrumented code only      */
+/*--------------------------------------------------------------------------------*/
+void __cyg_profile_func_exit(void* Copy_pFunction, void* Copy_pCallSite) __attribute__((no_instrument_function));
+
+#endif /* OS_TRACE_H_ */
@@ -39,4 +39,15 @@
 /*-------------------------------------------------------*/
 #define STK_EXCEPTION_REQUEST  DISABLE  /* Default: DISABLE */
 
+/*-------------------------------------------------------*/
+/* Enable/Disable capture of SysTick elapsed time at     */
+/* entry of the SysTick exception handler (exception     */
+/* latency):                                             */
+/*                                                       */
+/* Options	: - ENABLE                  	        	 */
+/* 			  - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define STK_ENTRY_CAPTURE  DISABLE  /* Default: DISABLE */
+
 #endif /* STK_CONFIG_H_ */
@@ -190,4 +190,51 @@ ERROR_STATUS_t STK_GetElapsedTime(uint32_t* Copy_pElapesdTime);
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t STK_GetRemainingTime(uint32_t* Copy_pRemainingTime);
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetEntryElapsedTime          				                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pElapsedTime                                    */
+/*				   Brief: Pointer to uint32_t variable that will hold STK elapsed */
+/*				          time captured at entry of the last SysTick exception    */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets the elapsed time of SysTick timer captured by the last	  */
+/*				   SysTick exception handler before touching the timer, which is  */
+/*				   the exception latency (RT_NOK if STK_ENTRY_CAPTURE is          */
+/*				   disabled)                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetEntryElapsedTime(uint32_t* Copy_pElapsedTime);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetEntryCycles          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pExpiryCycle                                    */
+/*				   Brief: Pointer to uint32_t variable that will hold cycle count */
+/*				          (DWT CYCCNT) at which the SysTick timer expired         */
+/*				   Range: None                                                    */
+/*  			   -------------------------------------------------------------- */
+/*				   uint32_t* Copy_pEntryCycle                                     */
+/*				   Brief: Pointer to uint32_t variable that will hold cycle count */
+/*				          (DWT CYCCNT) at entry of the SysTick exception handler  */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets the cycle counts of the expiry served by the last SysTick */
+/*				   exception and of its handler entry, rebuilt from the cycle     */
+/*				   count and elapsed time the handler captured before touching    */
+/*				   the timer (RT_NOK if STK_ENTRY_CAPTURE is disabled)            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetEntryCycles(uint32_t* Copy_pExpiryCycle, uint32_t* Copy_pEntryCycle);
+
 #endif /* STK_INTERFACE_H_ */
@@ -37,6 +37,9 @@ typedef struct
 
 #define STK  ((volatile STK_t*)0xE000E010)
 
+/* DWT cycle count register, read at SysTick exception entry when STK_ENTRY_CAPTURE is enabled */
+#define STK_DWT_CYCCNT  (*((volatile uint32_t*)0xE0001004))
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                              SOME BITS DEFINITIONS		 	             		 */
@@ -62,6 +65,9 @@ typedef struct
 /* Define Systick Clear Value */
 #define STK_CLEAR			   0U
 
+/* Define CPU cycles per SysTick count of the configured clock source (AHB or AHB/8) */
+#define STK_COUNT_CYCLES	   ((STK_CLK_SOURCE == AHB) ? 1UL : 8UL)
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                            CONFIGURATION OPTIONS VALUES		       		         */
@@ -0,0 +1,335 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Active Object             */
+/*     			    Description	 : OS Active Object Program File */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_ActiveObject.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+OS_ActiveObject_t* Global_ActiveObjectsArr[NUM_OF_TASKS];	/* Global array that holds object run by every task (by task priority) */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void OS_ActiveObjectDispatch(OS_ActiveObject_t* Copy_pMe, const OS_Event_t* Copy_pEvent);
+static void OS_ActiveObjectTask(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ActiveObjectStart                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task running the object                 */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 OS_StateHandler_t Copy_pInitialState                           */
+/*                 Brief: State the object starts in                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_ActiveObject_t* Copy_pMe                                    */
+/*                 Brief: Object to be started                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates the task of the object, empties its queue and enters   */
+/*                 its initial state, must be called before OS_Init like          */
+/*                 TASKS_CREATION (one of the NUM_OF_CREATED_TASKS descriptors)   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ActiveObjectStart(OS_ActiveObject_t* Copy_pMe, uint8_t Copy_Priority, OS_StateHandler_t Copy_pInitialState)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	OS_Event_t Local_EntryEvent = {OS_AO_SIG_ENTRY, 0};	/* A variable to hold entry event of the initial state */
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pMe != NULL && Copy_pInitialState != NULL)
+	{
+		/* Check if passed priority belongs to a task slot not running another object or not */
+		if(Copy_Priority < NUM_OF_TASKS && Global_ActiveObjectsArr[Copy_Priority] == NULL)
+		{
+			Copy_pMe->QueueHead = 0;
+			Copy_pMe->QueueCount = 0;
+			Copy_pMe->EventsLost = 0;
+			Copy_pMe->Priority = Copy_Priority;
+			Copy_pMe->pTargetState = NULL;
+			Copy_pMe->pState = Copy_pInitialState;
+
+			Global_ActiveObjectsArr[Copy_Priority] = Copy_pMe;
+
+			/* The object task has no period, it only runs when events are posted */
+			TASKS_CREATION(Copy_Priority, 0, OS_ActiveObjectTask);
+
+			/* Enter the initial state */
+			OS_ActiveObjectDispatch(Copy_pMe, &Local_EntryEvent);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ActiveObjectPost                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Signal                                            */
+/*                 Brief: Signal of the event                                     */
+/*                 Range: (OS_AO_SIG_USER --> 255)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Parameter                                        */
+/*                 Brief: Data coming with the signal                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_ActiveObject_t* Copy_pMe                                    */
+/*                 Brief: Object receiving the event                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (BUSY_FUNC if the queue is full)                */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Queues an event to an object and activates its task, O(1) and  */
+/*                 safe to be called from tasks and ISRs                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ActiveObjectPost(OS_ActiveObject_t* Copy_pMe, uint8_t Copy_Signal, uint32_t Copy_Parameter)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+	uint8_t Local_TailIndex;					/* A variable to hold index of the first free queue entry */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pMe != NULL)
+	{
+		/* Check if passed signal is an application signal or not */
+		if(Copy_Signal >= OS_AO_SIG_USER)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+
+			if(Copy_pMe->QueueCount < OS_AO_QUEUE_SIZE)
+			{
+				Local_TailIndex = Copy_pMe->QueueHead + Copy_pMe->QueueCount;
+
+				if(Local_TailIndex >= OS_AO_QUEUE_SIZE)
+				{
+					Local_TailIndex -= OS_AO_QUEUE_SIZE;
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+
+				Copy_pMe->QueueArr[Local_TailIndex].Signal = Copy_Signal;
+				Copy_pMe->QueueArr[Local_TailIndex].Parameter = Copy_Parameter;
+				Copy_pMe->QueueCount++;
+			}
+			else
+			{
+				/* Queue is full, the event is lost */
+				Copy_pMe->EventsLost++;
+				Local_Status = BUSY_FUNC;
+			}
+
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+
+			/* Let the object run, an activation deferred by an event storm still finds the event queued */
+			if(Local_Status == RT_OK)
+			{
+				(void)OS_TaskActivate(Copy_pMe->Priority);
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ActiveObjectTransition                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : OS_StateHandler_t Copy_pNewState                               */
+/*                 Brief: State to move to                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_ActiveObject_t* Copy_pMe                                    */
+/*                 Brief: Object whose handler is running                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Requests a transition, to be called from a state handler only, */
+/*                 the transition is taken once the handler returns               */
+/*--------------------------------------------------------------------------------*/
+void OS_ActiveObjectTransition(OS_ActiveObject_t* Copy_pMe, OS_StateHandler_t Copy_pNewState)
+{
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pMe != NULL && Copy_pNewState != NULL)
+	{
+		Copy_pMe->pTargetState = Copy_pNewState;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                         PRIVATE FUNCTIONS IMPLEMENTATIONS                         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ActiveObjectDispatch                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_Event_t* Copy_pEvent                                  */
+/*                 Brief: Event to be handled                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_ActiveObject_t* Copy_pMe                                    */
+/*                 Brief: Object handling the event                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs an event to completion in the current state, then takes   */
+/*                 the requested transitions with their exit and entry actions    */
+/*--------------------------------------------------------------------------------*/
+static void OS_ActiveObjectDispatch(OS_ActiveObject_t* Copy_pMe, const OS_Event_t* Copy_pEvent)
+{
+	/* Local Variables Definitions */
+	static const OS_Event_t Local_ExitEvent = {OS_AO_SIG_EXIT, 0};
+	static const OS_Event_t Local_EntryEvent = {OS_AO_SIG_ENTRY, 0};
+
+	Copy_pMe->pState(Copy_pMe, Copy_pEvent);
+
+	/* An entry action may request another transition, keep going until the object settles */
+	while(Copy_pMe->pTargetState != NULL)
+	{
+		/* Exit actions may not transition, the target is already chosen */
+		Copy_pMe->pState(Copy_pMe, &Local_ExitEvent);
+
+		Copy_pMe->pState = Copy_pMe->pTargetState;
+		Copy_pMe->pTargetState = NULL;
+
+		Copy_pMe->pState(Copy_pMe, &Local_EntryEvent);
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ActiveObjectTask                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Task body shared by all objects, runs the oldest queued event  */
+/*                 of the object mapped to the running task                       */
+/*--------------------------------------------------------------------------------*/
+static void OS_ActiveObjectTask(void)
+{
+	/* Local Variables Definitions */
+	OS_ActiveObject_t* Local_pMe = Global_ActiveObjectsArr[OS_GetRunningTask()];
+	OS_Event_t Local_Event;						/* A variable to hold the event taken out of the queue */
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+	uint8_t Local_EventTaken = 0;				/* A variable to hold whether an event was taken out of the queue */
+
+	/* Take the oldest event, posters may add events meanwhile */
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	if(Local_pMe->QueueCount != 0)
+	{
+		Local_Event = Local_pMe->QueueArr[Local_pMe->QueueHead];
+
+		Local_pMe->QueueHead++;
+
+		if(Local_pMe->QueueHead == OS_AO_QUEUE_SIZE)
+		{
+			Local_pMe->QueueHead = 0;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		Local_pMe->QueueCount--;
+		Local_EventTaken = 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+
+	if(Local_EventTaken == 1)
+	{
+		/* Run the event to completion */
+		OS_ActiveObjectDispatch(Local_pMe, &Local_Event);
+
+		/* Events left are handled in the next pass, so higher priority tasks made ready meanwhile run first */
+		if(Local_pMe->QueueCount != 0)
+		{
+			OS_ReleaseTask(Local_pMe->Priority);
+			OS_PEND_DISPATCH();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
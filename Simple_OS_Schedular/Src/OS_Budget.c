@@ -0,0 +1,449 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Budget                    */
+/*     			    Description	 : OS Budget Program File       */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "RCC_Interface.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Srp.h"
+#include "OS_Budget.h"
+
+#if OS_BUDGET_ENFORCEMENT == ENABLE
+
+	#if OS_SRP_HIGHEST_TASK_LEVEL == 0
+
+		#error " OS_BUDGET_ENFORCEMENT Requires OS_SRP_HIGHEST_TASK_LEVEL Above 0 !"
+
+	#endif
+
+	#if OS_BUDGET_ACTION == OS_BUDGET_DEMOTE && OS_SCHEDULING_MODE != OS_PREEMPTIVE_SRP
+
+		#error " OS_BUDGET_DEMOTE Requires OS_PREEMPTIVE_SRP Scheduling Mode !"
+
+	#elif OS_BUDGET_ACTION != OS_BUDGET_NOTIFY && OS_BUDGET_ACTION != OS_BUDGET_SUSPEND && OS_BUDGET_ACTION != OS_BUDGET_DEMOTE
+
+		#error " Wrong OS_BUDGET_ACTION Configuration !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint16_t Global_TaskBudgetArr[NUM_OF_TASKS];					/* CPU budget of every task in microseconds (0 for no budget) */
+static uint16_t Global_TaskDeadlineArr[NUM_OF_TASKS];				/* Budget timer count at which the current run of every task is over budget */
+static volatile uint32_t Global_BudgetOverrunsArr[NUM_OF_TASKS];	/* Number of runs of every task that exceeded its budget */
+static volatile uint32_t Global_BudgetExceededMask = 0;				/* One bit per running task that exceeded its budget in its current run */
+static void (* volatile Global_pBudgetCallback)(uint8_t) = NULL;	/* Budget overrun callback */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS PROTOTYPES                          */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void OS_BudgetArm(uint8_t Copy_Priority);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetInit                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Starts the budget timer and enables its interrupt, called by   */
+/*                 OS_Init when OS_BUDGET_ENFORCEMENT is enabled                  */
+/*--------------------------------------------------------------------------------*/
+void OS_BudgetInit(void)
+{
+	RCC_EnablePeripheralClk(RCC_APB1, RCC_TIM2);
+
+	/* Free running 16-bit count at 1 MHz, channel 1 left in frozen output compare mode */
+	OS_BUDGET_TIMER->PSC = (OS_CPU_CLOCK_HZ / 1000000UL) - 1UL;
+	OS_BUDGET_TIMER->ARR = 0xFFFFUL;
+	OS_BUDGET_TIMER->DIER = 0;
+	OS_BUDGET_TIMER->EGR = (1UL << TIM_EGR_UG);
+	OS_BUDGET_TIMER->SR = 0;
+	SET_BIT(OS_BUDGET_TIMER->CR1, TIM_CR1_CEN);
+
+	/* The compare interrupt has to preempt every task */
+	NVIC_IPR[OS_BUDGET_TIMER_IRQ] = (uint8_t)((OS_SRP_HIGHEST_TASK_LEVEL - 1U) << OS_NVIC_PRIORITY_SHIFT);
+	NVIC_ISER[OS_BUDGET_TIMER_IRQ >> 5] = (1UL << (OS_BUDGET_TIMER_IRQ & 0x1FU));
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetBudget                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint16_t Copy_BudgetUs                                         */
+/*                 Brief: CPU budget of every run of the task in microseconds     */
+/*                 Range: (0 --> 32767) where 0 means no budget                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the CPU budget of a task, applied from its next run       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetBudget(uint8_t Copy_Priority, uint16_t Copy_BudgetUs)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed priority belongs to a task in the system and passed budget is within the signed compare range or not */
+	if(Copy_Priority < NUM_OF_TASKS && Copy_BudgetUs <= OS_BUDGET_MAX_US)
+	{
+		Global_TaskBudgetArr[Copy_Priority] = Copy_BudgetUs;
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskGetBudget                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint16_t* Copy_pBudgetUs                                       */
+/*                 Brief: CPU budget of the task in microseconds (0 for none)     */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the CPU budget of a task                                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskGetBudget(uint8_t Copy_Priority, uint16_t* Copy_pBudgetUs)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pBudgetUs != NULL)
+	{
+		/* Check if passed priority belongs to a task in the system or not */
+		if(Copy_Priority < NUM_OF_TASKS)
+		{
+			*Copy_pBudgetUs = Global_TaskBudgetArr[Copy_Priority];
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetSetCallback                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void (*Copy_pCallback)(uint8_t)                                */
+/*                 Brief: Function called with the priority of every task that    */
+/*                        exceeds its budget (may be NULL)                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the budget overrun callback                               */
+/*--------------------------------------------------------------------------------*/
+void OS_BudgetSetCallback(void (*Copy_pCallback)(uint8_t))
+{
+	Global_pBudgetCallback = Copy_pCallback;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetGetOverruns                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pOverrunCount                                   */
+/*                 Brief: Number of runs of the task that exceeded its budget     */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the budget overrun count of a task                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_BudgetGetOverruns(uint8_t Copy_Priority, uint32_t* Copy_pOverrunCount)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pOverrunCount != NULL)
+	{
+		/* Check if passed priority belongs to a task in the system or not */
+		if(Copy_Priority < NUM_OF_TASKS)
+		{
+			*Copy_pOverrunCount = Global_BudgetOverrunsArr[Copy_Priority];
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetStart                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task being dispatched                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint16_t                                                       */
+/*                 Brief: Budget timer count at dispatch, to be passed back to    */
+/*                        OS_BudgetStop                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Arms the budget compare of a task, called by OS_ExecuteTask    */
+/*                 right before the task function                                 */
+/*--------------------------------------------------------------------------------*/
+uint16_t OS_BudgetStart(uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	uint16_t Local_Now;					/* A variable to hold budget timer count at dispatch */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Local_Now = (uint16_t)OS_BUDGET_TIMER->CNT;
+
+	/* The whole budget is left at dispatch */
+	Global_TaskDeadlineArr[Copy_Priority] = (uint16_t)(Local_Now + Global_TaskBudgetArr[Copy_Priority]);
+	CLEAR_BIT(Global_BudgetExceededMask, Copy_Priority);
+
+	OS_BudgetArm(Copy_Priority);
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+
+	return Local_Now;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetStop                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task that returned                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_PreviousTask                                      */
+/*                 Brief: Task preempted by it (OS_NO_TASK if none)               */
+/*                 -------------------------------------------------------------- */
+/*                 uint16_t Copy_StartCount                                       */
+/*                 Brief: Count returned by the matching OS_BudgetStart           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Applies the overrun action of the returned task and re-arms    */
+/*                 the compare of the preempted task, called by OS_ExecuteTask    */
+/*                 right after the task function                                  */
+/*--------------------------------------------------------------------------------*/
+void OS_BudgetStop(uint8_t Copy_Priority, uint8_t Copy_PreviousTask, uint16_t Copy_StartCount)
+{
+	/* Local Variables Definitions */
+	uint16_t Local_Now;					/* A variable to hold budget timer count at return */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Local_Now = (uint16_t)OS_BUDGET_TIMER->CNT;
+
+	/* Apply the overrun action now that the task returned */
+	if(GET_BIT(Global_BudgetExceededMask, Copy_Priority))
+	{
+		CLEAR_BIT(Global_BudgetExceededMask, Copy_Priority);
+
+		#if   OS_BUDGET_ACTION == OS_BUDGET_SUSPEND
+
+			/* Keep the task out of every next pass until it is resumed */
+			(void)OS_TaskSuspend(Copy_Priority);
+
+		#elif OS_BUDGET_ACTION == OS_BUDGET_DEMOTE
+
+			/* Give the task its own level back for its next run */
+			OS_SrpSetTaskLevel(Copy_Priority, (uint8_t)(OS_SRP_HIGHEST_TASK_LEVEL + Copy_Priority));
+
+		#endif
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* The preempted task resumes, the time taken by this one is not charged to it */
+	if(Copy_PreviousTask != OS_NO_TASK)
+	{
+		Global_TaskDeadlineArr[Copy_PreviousTask] += (uint16_t)(Local_Now - Copy_StartCount);
+		OS_BudgetArm(Copy_PreviousTask);
+	}
+	else
+	{
+		/* No task left running, nothing to watch */
+		CLEAR_BIT(OS_BUDGET_TIMER->DIER, TIM_DIER_CC1IE);
+	}
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS IMPLEMENTATIONS                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_BudgetArm                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task about to run                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the compare to the deadline of a task, a deadline already */
+/*                 passed triggers the compare interrupt right away (called with  */
+/*                 interrupts masked)                                             */
+/*--------------------------------------------------------------------------------*/
+static void OS_BudgetArm(uint8_t Copy_Priority)
+{
+	/* A task with no budget or already over it is not watched */
+	if(Global_TaskBudgetArr[Copy_Priority] != 0 && !GET_BIT(Global_BudgetExceededMask, Copy_Priority))
+	{
+		/* Drop a match of the previous compare before the new one is set, a match of the new one then stays flagged */
+		CLEAR_BIT(OS_BUDGET_TIMER->SR, TIM_SR_CC1IF);
+		OS_BUDGET_TIMER->CCR1 = Global_TaskDeadlineArr[Copy_Priority];
+		SET_BIT(OS_BUDGET_TIMER->DIER, TIM_DIER_CC1IE);
+
+		/* The counter read after the compare is set catches a deadline passed before or while arming */
+		if((sint16_t)(Global_TaskDeadlineArr[Copy_Priority] - (uint16_t)OS_BUDGET_TIMER->CNT) <= 0)
+		{
+			/* Compare missed, generate the compare event by software */
+			OS_BUDGET_TIMER->EGR = (1UL << TIM_EGR_CC1G);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		CLEAR_BIT(OS_BUDGET_TIMER->DIER, TIM_DIER_CC1IE);
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            	  INTERRUPT HANDLERS		                    	 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: TIM2 Handler, the task running on top is over its budget        */
+/*--------------------------------------------------------------------------------*/
+void TIM2_IRQHandler(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_TaskPriority = OS_GetRunningTask();	/* A variable to hold priority of the task over its budget */
+
+	/* One overrun per run, the compare is re-armed at the next dispatch */
+	CLEAR_BIT(OS_BUDGET_TIMER->DIER, TIM_DIER_CC1IE);
+	CLEAR_BIT(OS_BUDGET_TIMER->SR, TIM_SR_CC1IF);
+
+	if(Local_TaskPriority != OS_NO_TASK)
+	{
+		SET_BIT(Global_BudgetExceededMask, Local_TaskPriority);
+		Global_BudgetOverrunsArr[Local_TaskPriority]++;
+
+		#if OS_BUDGET_ACTION == OS_BUDGET_DEMOTE
+
+			/* Let every other task preempt it until it returns (the level never drops below the tasks it preempted) */
+			OS_SrpSetTaskLevel(Local_TaskPriority, (uint8_t)(OS_SRP_HIGHEST_TASK_LEVEL + NUM_OF_TASKS - 1U));
+
+		#endif
+
+		if(Global_pBudgetCallback != NULL)
+		{
+			Global_pBudgetCallback(Local_TaskPriority);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+#elif OS_BUDGET_ENFORCEMENT != DISABLE
+
+	#error " Wrong OS_BUDGET_ENFORCEMENT Configuration !"
+
+#endif
@@ -0,0 +1,398 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Chain                     */
+/*     			    Description	 : OS Chain Program File        */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Chain.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+OS_Chain_t Global_ChainsArr[OS_NUM_OF_CHAINS];
+
+/* Global arrays that hold chain and stage index of every task (by task priority) */
+uint8_t Global_TaskChainArr[NUM_OF_TASKS] = {[0 ... (NUM_OF_TASKS - 1)] = OS_CHAIN_NONE};
+uint8_t Global_TaskStageArr[NUM_OF_TASKS];
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void OS_ChainStageTask(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainCreate                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_ChainId                                           */
+/*                 Brief: Index of the chain in the chains table                  */
+/*                 Range: (0 --> OS_NUM_OF_CHAINS - 1)                            */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: Periodicity of the head stage in OS ticks, 0 for a      */
+/*                        chain only started through OS_ReleaseTask on its head   */
+/*                 -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pPriorities                                */
+/*                 Brief: Priorities of the stages tasks in pipeline order        */
+/*                 -------------------------------------------------------------- */
+/*                 void (* const * Copy_pFunctions)(void)                         */
+/*                 Brief: Stages functions in pipeline order                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_NumOfStages                                       */
+/*                 Brief: Number of stages                                        */
+/*                 Range: (2 --> OS_CHAIN_MAX_STAGES)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task per stage and links every stage to the next     */
+/*                 one, must be called before OS_Init like TASKS_CREATION         */
+/*                 (one of the NUM_OF_CREATED_TASKS descriptors per stage)        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ChainCreate(uint8_t Copy_ChainId, uint8_t Copy_Periodicity, const uint8_t* Copy_pPriorities,
+							  void (* const * Copy_pFunctions)(void), uint8_t Copy_NumOfStages)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_StageCounter;				/* A variable to hold count of stages */
+	uint32_t Local_UsedTasks = 0;			/* A variable to hold tasks already taken by a stage of this chain */
+	uint8_t Local_TaskPriority;				/* A variable to hold priority of the current stage task */
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pPriorities != NULL && Copy_pFunctions != NULL)
+	{
+		/* Check if passed chain is free and passed number of stages is within valid range or not */
+		if(Copy_ChainId < OS_NUM_OF_CHAINS && Global_ChainsArr[Copy_ChainId].NumOfStages == 0 &&
+		   Copy_NumOfStages >= 2 && Copy_NumOfStages <= OS_CHAIN_MAX_STAGES)
+		{
+			/* Check every stage before changing anything, a stage task must be unique and not part of another chain */
+			for(Local_StageCounter = 0 ; Local_StageCounter < Copy_NumOfStages && Local_Status == RT_OK ; Local_StageCounter++)
+			{
+				Local_TaskPriority = Copy_pPriorities[Local_StageCounter];
+
+				if(Local_TaskPriority < NUM_OF_TASKS && GET_BIT(Local_UsedTasks, Local_TaskPriority) == 0 &&
+				   Global_TaskChainArr[Local_TaskPriority] == OS_CHAIN_NONE && Copy_pFunctions[Local_StageCounter] != NULL)
+				{
+					Local_UsedTasks |= (1UL << Local_TaskPriority);
+				}
+				else
+				{
+					/* Function is not behaving as expected */
+					Local_Status = RT_NOK;
+				}
+			}
+
+			if(Local_Status == RT_OK)
+			{
+				for(Local_StageCounter = 0 ; Local_StageCounter < Copy_NumOfStages ; Local_StageCounter++)
+				{
+					Local_TaskPriority = Copy_pPriorities[Local_StageCounter];
+
+					Global_ChainsArr[Copy_ChainId].StagesArr[Local_StageCounter] = Local_TaskPriority;
+					Global_ChainsArr[Copy_ChainId].StageFunctionsArr[Local_StageCounter] = Copy_pFunctions[Local_StageCounter];
+					Global_TaskChainArr[Local_TaskPriority] = Copy_ChainId;
+					Global_TaskStageArr[Local_TaskPriority] = Local_StageCounter;
+
+					/* Only the head stage is periodic, the next stages are released by their predecessor */
+					TASKS_CREATION(Local_TaskPriority, (Local_StageCounter == 0) ? Copy_Periodicity : 0, OS_ChainStageTask);
+
+					/* Successors left from a previous use of the task are dropped, the last stage keeps none */
+					(void)OS_TaskSetSuccessors(Local_TaskPriority, 0);
+
+					if(Local_StageCounter != 0)
+					{
+						/* The stage has no successors yet so linking it to its predecessor can not close a cycle */
+						(void)OS_TaskSetSuccessors(Copy_pPriorities[Local_StageCounter - 1], (1UL << Local_TaskPriority));
+					}
+					else
+					{
+						/* Do Nothing */
+					}
+				}
+
+				/* Setting the number of stages marks the chain as created */
+				Global_ChainsArr[Copy_ChainId].NumOfStages = Copy_NumOfStages;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainHandOver                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const void* Copy_pData                                         */
+/*                 Brief: Pointer to the output of the running stage              */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Size                                              */
+/*                 Brief: Size of the output in bytes                             */
+/*                 Range: (1 --> OS_CHAIN_DATA_SIZE)                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Hands the output of the running stage over to the next stage   */
+/*                 of its chain, to be called from a stage function only          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ChainHandOver(const void* Copy_pData, uint8_t Copy_Size)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_TaskPriority = OS_GetRunningTask();	/* A variable to hold priority of the running stage */
+	OS_Chain_t* Local_pChain;							/* A variable to hold chain of the running stage */
+	uint8_t Local_ByteCounter;							/* A variable to hold count of copied bytes */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pData != NULL)
+	{
+		/* Check if called from a chain stage and passed size is within valid range or not */
+		if(Local_TaskPriority < NUM_OF_TASKS && Global_TaskChainArr[Local_TaskPriority] != OS_CHAIN_NONE &&
+		   Copy_Size != 0 && Copy_Size <= OS_CHAIN_DATA_SIZE)
+		{
+			Local_pChain = &Global_ChainsArr[Global_TaskChainArr[Local_TaskPriority]];
+
+			for(Local_ByteCounter = 0 ; Local_ByteCounter < Copy_Size ; Local_ByteCounter++)
+			{
+				Local_pChain->Data[Local_ByteCounter] = ((const uint8_t*)Copy_pData)[Local_ByteCounter];
+			}
+
+			Local_pChain->DataSize = Copy_Size;
+			Local_pChain->DataStage = Global_TaskStageArr[Local_TaskPriority];
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainReceive                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Size                                              */
+/*                 Brief: Size of the data buffer, must match handed over size    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : void* Copy_pData                                               */
+/*                 Brief: Pointer to where the handed over data is copied         */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (RT_NOK if previous stage handed nothing over   */
+/*                 or handed over data of another size)                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the data handed over by the previous stage of the chain   */
+/*                 of the running stage, to be called from a stage function only  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ChainReceive(void* Copy_pData, uint8_t Copy_Size)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_TaskPriority = OS_GetRunningTask();	/* A variable to hold priority of the running stage */
+	OS_Chain_t* Local_pChain;							/* A variable to hold chain of the running stage */
+	uint8_t Local_ByteCounter;							/* A variable to hold count of copied bytes */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pData != NULL)
+	{
+		/* Check if called from a chain stage other than the head or not */
+		if(Local_TaskPriority < NUM_OF_TASKS && Global_TaskChainArr[Local_TaskPriority] != OS_CHAIN_NONE &&
+		   Global_TaskStageArr[Local_TaskPriority] != 0)
+		{
+			Local_pChain = &Global_ChainsArr[Global_TaskChainArr[Local_TaskPriority]];
+
+			/* Only data handed over by the stage right before the running one in this run is valid */
+			if(Local_pChain->DataSize == Copy_Size && Local_pChain->DataStage == Global_TaskStageArr[Local_TaskPriority] - 1)
+			{
+				for(Local_ByteCounter = 0 ; Local_ByteCounter < Copy_Size ; Local_ByteCounter++)
+				{
+					((uint8_t*)Copy_pData)[Local_ByteCounter] = Local_pChain->Data[Local_ByteCounter];
+				}
+			}
+			else
+			{
+				/* Function is not behaving as expected */
+				Local_Status = RT_NOK;
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainGetStats                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_ChainId                                           */
+/*                 Brief: Index of the chain                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_ChainStats_t* Copy_pStats                                   */
+/*                 Brief: Pointer to where end to end latency statistics are      */
+/*                        copied                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the end to end latency statistics of a chain              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ChainGetStats(uint8_t Copy_ChainId, OS_ChainStats_t* Copy_pStats)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pStats != NULL)
+	{
+		/* Check if passed chain is created or not */
+		if(Copy_ChainId < OS_NUM_OF_CHAINS && Global_ChainsArr[Copy_ChainId].NumOfStages != 0)
+		{
+			/* Copy statistics at once so that they belong to the same run */
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+			*Copy_pStats = Global_ChainsArr[Copy_ChainId].Stats;
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                         PRIVATE FUNCTIONS IMPLEMENTATIONS                         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ChainStageTask                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Task body shared by all stages, runs the function of the       */
+/*                 running stage and measures end to end latency of its chain     */
+/*--------------------------------------------------------------------------------*/
+static void OS_ChainStageTask(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_TaskPriority = OS_GetRunningTask();	/* A variable to hold priority of the running stage */
+	uint8_t Local_StageIndex;							/* A variable to hold index of the running stage */
+	OS_Chain_t* Local_pChain;							/* A variable to hold chain of the running stage */
+	uint32_t Local_Latency;								/* A variable to hold end to end latency of this run */
+
+	Local_pChain = &Global_ChainsArr[Global_TaskChainArr[Local_TaskPriority]];
+	Local_StageIndex = Global_TaskStageArr[Local_TaskPriority];
+
+	/* A new run starts with the head stage, nothing is handed over yet */
+	if(Local_StageIndex == 0)
+	{
+		Local_pChain->StartCycle = OS_GetCycleCount();
+		Local_pChain->DataSize = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* Execute the stage function */
+	Local_pChain->StageFunctionsArr[Local_StageIndex]();
+
+	/* The run ends with the last stage */
+	if(Local_StageIndex == Local_pChain->NumOfStages - 1)
+	{
+		Local_Latency = OS_GetCycleCount() - Local_pChain->StartCycle;
+
+		Local_pChain->Stats.Completions++;
+		Local_pChain->Stats.LastLatency = Local_Latency;
+
+		if(Local_Latency > Local_pChain->Stats.MaxLatency)
+		{
+			Local_pChain->Stats.MaxLatency = Local_Latency;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
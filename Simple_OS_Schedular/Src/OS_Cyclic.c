@@ -0,0 +1,194 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Cyclic                    */
+/*     			    Description	 : OS Cyclic Program File       */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "STK_Config.h"
+#include "STK_Private.h"
+#include "STK_Interface.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Cyclic.h"
+#include "OS_Histogram.h"
+#include "OS_CyclicTable.h"
+
+#if OS_CYCLIC_EXECUTIVE == ENABLE
+
+	#if OS_SCHEDULING_MODE != OS_COOPERATIVE || OS_STATIC_TASK_SET != DISABLE
+
+		#error " OS_CYCLIC_EXECUTIVE Requires OS_COOPERATIVE Scheduling Mode With OS_STATIC_TASK_SET Disabled !"
+
+	#elif OS_CYCLIC_NUM_OF_FRAMES < 1U || OS_CYCLIC_NUM_OF_FRAMES > 65535U
+
+		#error " Wrong OS_CYCLIC_NUM_OF_FRAMES Configuration !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* SysTick counts per second at the configured clock source */
+#if   STK_CLK_SOURCE == AHB_DIV_BY_EIGHT
+
+	#define OS_CYCLIC_SYSTICK_HZ		(OS_CPU_CLOCK_HZ / 8UL)
+
+#elif STK_CLK_SOURCE == AHB
+
+	#define OS_CYCLIC_SYSTICK_HZ		OS_CPU_CLOCK_HZ
+
+#endif
+
+/* The generated minor frame is the SysTick period, its reload has 24 bits only */
+_Static_assert(((unsigned long long)OS_CYCLIC_MINOR_FRAME_US * OS_CYCLIC_SYSTICK_HZ) / 1000000ULL <= STK_MAX_VALUE, "OS_CYCLIC_MINOR_FRAME_US exceeds the 24-bit SysTick reload at the configured clock source");
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static const uint32_t Global_CyclicFrameTableArr[OS_CYCLIC_NUM_OF_FRAMES] = OS_CYCLIC_FRAME_TABLE;	/* Tasks of every minor frame, kept in flash */
+static uint16_t Global_CyclicCurrentFrame = 0;				/* Index of the next minor frame to be run */
+static volatile uint32_t Global_CyclicOverrunCount = 0;		/* Number of overrun frames */
+static volatile uint16_t Global_CyclicLastOverrunFrame = 0;	/* Index of the last overrun frame */
+
+extern OS_Schedular_t Global_Schedular;				/* Counts minor frames so that OS_GetTickCount still works, suspended and deleted tasks are skipped in their frames */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_CyclicExecutive                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs the tasks of the current minor frame and checks it for    */
+/*                 overrun, called every minor frame instead of SCHEDULAR when    */
+/*                 OS_CYCLIC_EXECUTIVE is enabled                                 */
+/*--------------------------------------------------------------------------------*/
+void OS_CyclicExecutive(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_FrameTasks;		/* A variable to hold tasks of the frame still to be run */
+	uint8_t Local_TaskPriority;		/* A variable to hold priority of the task being run */
+	uint16_t Local_Frame;			/* A variable to hold index of the frame being run */
+
+	/* Increment System Tick Counter */
+	Global_Schedular.TickCounter++;
+
+	/* Table lookup, the frame decides which tasks run */
+	Local_Frame = Global_CyclicCurrentFrame;
+	Local_FrameTasks = Global_CyclicFrameTableArr[Local_Frame] & Global_Schedular.ActiveMask;
+
+	Global_CyclicCurrentFrame = (Local_Frame + 1U == OS_CYCLIC_NUM_OF_FRAMES) ? 0U : (uint16_t)(Local_Frame + 1U);
+
+	#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+		/* Tasks of the frame are due at the start of the frame */
+		OS_HistogramStampPass(Local_FrameTasks);
+
+	#endif
+
+	/* Run the tasks of the frame in priority order */
+	while(Local_FrameTasks != 0)
+	{
+		Local_TaskPriority = (uint8_t)__builtin_ctzl(Local_FrameTasks);
+		CLEAR_BIT(Local_FrameTasks, Local_TaskPriority);
+
+		/* Successors are not released, the table is the only source of releases */
+		(void)OS_ExecuteTask(Local_TaskPriority);
+	}
+
+	/* The next frame interrupt is already pending if the tasks of this frame ran past its end */
+	if(GET_BIT(SCB_ICSR, SCB_ICSR_PENDSTSET))
+	{
+		Global_CyclicOverrunCount++;
+		Global_CyclicLastOverrunFrame = Local_Frame;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_CyclicGetOverruns                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pOverrunCount                                   */
+/*                 Brief: Number of overrun frames since OS_Init                  */
+/*                 -------------------------------------------------------------- */
+/*                 uint16_t* Copy_pLastOverrunFrame                               */
+/*                 Brief: Index of the last overrun frame in the major frame      */
+/*                        (may be NULL)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the frame overrun statistics of the cyclic executive      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_CyclicGetOverruns(uint32_t* Copy_pOverrunCount, uint16_t* Copy_pLastOverrunFrame)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pOverrunCount != NULL)
+	{
+		/* Read both values of the same overrun */
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		*Copy_pOverrunCount = Global_CyclicOverrunCount;
+
+		if(Copy_pLastOverrunFrame != NULL)
+		{
+			*Copy_pLastOverrunFrame = Global_CyclicLastOverrunFrame;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+#elif OS_CYCLIC_EXECUTIVE != DISABLE
+
+	#error " Wrong OS_CYCLIC_EXECUTIVE Configuration !"
+
+#endif
@@ -0,0 +1,398 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Histogram                 */
+/*     			    Description	 : OS Histogram Program File    */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "STK_Config.h"
+#include "STK_Interface.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Histogram.h"
+
+#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+	#if STK_ENTRY_CAPTURE != ENABLE
+
+		#error " OS_LATENCY_HISTOGRAMS Requires STK_ENTRY_CAPTURE !"
+
+	#elif OS_HISTOGRAM_NUM_OF_BUCKETS < 2U || OS_HISTOGRAM_NUM_OF_BUCKETS > 32U
+
+		#error " Wrong OS_HISTOGRAM_NUM_OF_BUCKETS Configuration !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static OS_Histogram_t Global_HistogramsArr[NUM_OF_TASKS][2];		/* Jitter and response time histograms of every task */
+static uint32_t Global_HistogramReleaseArr[NUM_OF_TASKS];			/* Nominal release of the pending run of every task */
+static uint32_t Global_HistogramEventMask = 0;						/* One bit per task whose release was set by an event */
+static uint32_t Global_HistogramPassCycle = 0;						/* Nominal release of the tasks released by the current pass */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramTickStart                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Takes the SysTick expiry as nominal release of the tasks       */
+/*                 released by this pass, called at the start of the tick pass    */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramTickStart(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_EntryCycle = 0;		/* A variable to hold cycle count at SysTick handler entry */
+
+	/* Expiry instant captured by SysTick_Handler before it touched the timer, so its entry latency counts as jitter */
+	(void)STK_GetEntryCycles(&Global_HistogramPassCycle, &Local_EntryCycle);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramEventStart                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Takes the current time as nominal release of the tasks         */
+/*                 released by this pass, called at the start of the event pass   */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramEventStart(void)
+{
+	Global_HistogramPassCycle = OS_CYCLE_COUNT();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramStampEvent                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task activated by an event              */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_CycleCount                                       */
+/*                 Brief: Cycle count at which the activation was accepted        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the nominal release of an event activation, called by     */
+/*                 OS_TaskActivate and for deferred activations                   */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramStampEvent(uint8_t Copy_Priority, uint32_t Copy_CycleCount)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Global_HistogramReleaseArr[Copy_Priority] = Copy_CycleCount;
+	SET_BIT(Global_HistogramEventMask, Copy_Priority);
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramStampPass                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_ReleasedTasks                                    */
+/*                 Brief: Tasks released by the current pass                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the nominal release of the released tasks that were not   */
+/*                 activated by an event to the start of the current pass         */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramStampPass(uint32_t Copy_ReleasedTasks)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+	uint32_t Local_PassTasks;			/* A variable to hold tasks released by the pass itself */
+	uint8_t Local_TaskPriority;			/* A variable to hold priority of the task being stamped */
+
+	/* An event may stamp a task between the check and the stamp */
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Local_PassTasks = Copy_ReleasedTasks & ~Global_HistogramEventMask;
+	Global_HistogramEventMask &= ~Copy_ReleasedTasks;
+
+	while(Local_PassTasks != 0)
+	{
+		Local_TaskPriority = (uint8_t)__builtin_ctzl(Local_PassTasks);
+		CLEAR_BIT(Local_PassTasks, Local_TaskPriority);
+
+		Global_HistogramReleaseArr[Local_TaskPriority] = Global_HistogramPassCycle;
+	}
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramTaskStart                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task being started                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_HistogramTaskState_t* Copy_pState                           */
+/*                 Brief: Release and start of the run for OS_HistogramRecord     */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Takes the nominal release and start time of a task run, so a   */
+/*                 new release during the run does not change them, called by     */
+/*                 OS_ExecuteTask                                                 */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramTaskStart(uint8_t Copy_Priority, OS_HistogramTaskState_t* Copy_pState)
+{
+	Copy_pState->ReleaseCycle = Global_HistogramReleaseArr[Copy_Priority];
+	Copy_pState->StartCycle = OS_CYCLE_COUNT();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramRecord                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task that returned                      */
+/*                 -------------------------------------------------------------- */
+/*                 const OS_HistogramTaskState_t* Copy_pState                     */
+/*                 Brief: State filled by OS_HistogramTaskStart                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records the release jitter and response time of a task run,    */
+/*                 called by OS_ExecuteTask                                       */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramRecord(uint8_t Copy_Priority, const OS_HistogramTaskState_t* Copy_pState)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_EndCycle = OS_CYCLE_COUNT();	/* A variable to hold cycle count at completion */
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before entering critical section */
+
+	/* A reader or a reset must not see the histograms half updated */
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	OS_HistogramAdd(&Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_JITTER], Copy_pState->StartCycle - Copy_pState->ReleaseCycle);
+	OS_HistogramAdd(&Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_RESPONSE], Local_EndCycle - Copy_pState->ReleaseCycle);
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramRead                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Kind                                              */
+/*                 Brief: OS_HISTOGRAM_JITTER or OS_HISTOGRAM_RESPONSE            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_Histogram_t* Copy_pHistogram                                */
+/*                 Brief: Copy of the histogram                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets a consistent copy of a histogram of a task                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_HistogramRead(uint8_t Copy_Priority, uint8_t Copy_Kind, OS_Histogram_t* Copy_pHistogram)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pHistogram != NULL)
+	{
+		/* Check if passed priority and histogram kind are valid or not */
+		if(Copy_Priority < NUM_OF_TASKS && Copy_Kind <= OS_HISTOGRAM_RESPONSE)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+			*Copy_pHistogram = Global_HistogramsArr[Copy_Priority][Copy_Kind];
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramReset                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Clears both histograms of a task                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_HistogramReset(uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+	uint8_t Local_BucketsCounter;		/* A variable to hold bucket count */
+
+	/* Check if passed priority belongs to a task in the system or not */
+	if(Copy_Priority < NUM_OF_TASKS)
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_JITTER].Count = 0;
+		Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_RESPONSE].Count = 0;
+
+		for(Local_BucketsCounter = 0 ; Local_BucketsCounter < OS_HISTOGRAM_NUM_OF_BUCKETS ; Local_BucketsCounter++)
+		{
+			Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_JITTER].BucketsArr[Local_BucketsCounter] = 0;
+			Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_RESPONSE].BucketsArr[Local_BucketsCounter] = 0;
+		}
+
+		/* Min and max restart from the next recorded time */
+		Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_JITTER].Min = 0;
+		Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_JITTER].Max = 0;
+		Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_RESPONSE].Min = 0;
+		Global_HistogramsArr[Copy_Priority][OS_HISTOGRAM_RESPONSE].Max = 0;
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS IMPLEMENTATIONS                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_HistogramAdd                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_Cycles                                           */
+/*                 Brief: Time to be recorded in cycles                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Histogram_t* Copy_pHistogram                                */
+/*                 Brief: Histogram the time is added to                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Adds a time to its log2 bucket and updates count, min and max, */
+/*                 not protected against a concurrent add, read or reset          */
+/*--------------------------------------------------------------------------------*/
+void OS_HistogramAdd(OS_Histogram_t* Copy_pHistogram, uint32_t Copy_Cycles)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Bucket;				/* A variable to hold bucket of the time (bit length of the time) */
+
+	Local_Bucket = (Copy_Cycles == 0) ? 0U : (uint8_t)(32U - (uint8_t)__builtin_clzl(Copy_Cycles));
+
+	if(Local_Bucket >= OS_HISTOGRAM_NUM_OF_BUCKETS)
+	{
+		/* Longer times are all kept in the last bucket */
+		Local_Bucket = OS_HISTOGRAM_NUM_OF_BUCKETS - 1U;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(Copy_pHistogram->BucketsArr[Local_Bucket] != 0xFFFFU)
+	{
+		Copy_pHistogram->BucketsArr[Local_Bucket]++;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(Copy_pHistogram->Count == 0 || Copy_Cycles < Copy_pHistogram->Min)
+	{
+		Copy_pHistogram->Min = Copy_Cycles;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(Copy_Cycles > Copy_pHistogram->Max)
+	{
+		Copy_pHistogram->Max = Copy_Cycles;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	Copy_pHistogram->Count++;
+}
+
+#elif OS_LATENCY_HISTOGRAMS != DISABLE
+
+	#error " Wrong OS_LATENCY_HISTOGRAMS Configuration !"
+
+#endif
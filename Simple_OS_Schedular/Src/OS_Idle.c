@@ -0,0 +1,311 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Idle                      */
+/*     			    Description	 : OS Idle Program File         */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Idle.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint8_t (*Global_IdleJobsArr[OS_NUM_OF_IDLE_JOBS])(void);	/* Global variable that holds the background jobs run by the idle loop */
+static uint8_t Global_IdleNextJob = 0;						/* Global variable that holds index of the job to run on next call of OS_IdleRun */
+static uint8_t Global_IdleRoundPending = 0;					/* Global variable that holds whether a job of the current round reported more work */
+
+/* Flash checksum background job state */
+static const uint32_t* Global_pChecksumAddress = NULL;		/* Global variable that holds address of the next flash word to accumulate */
+static uint32_t Global_ChecksumAccumulator = 0;				/* Global variable that holds checksum of the current pass so far */
+static volatile uint32_t Global_FlashChecksum = 0;			/* Global variable that holds checksum of the last complete pass */
+static volatile uint32_t Global_FlashChecksumPasses = 0;	/* Global variable that holds number of complete checksum passes */
+
+/* Linker script symbols bounding the initialized data image stored in flash after the code */
+extern uint32_t _sidata;
+extern uint32_t _sdata;
+extern uint32_t _edata;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleJobCreate                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_JobId                                             */
+/*                 Brief: Index of the job in the background jobs table           */
+/*                 Range: (0 --> OS_NUM_OF_IDLE_JOBS - 1)                         */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t (*Copy_pJob)(void)                                     */
+/*                 Brief: Job function doing one bounded slice of work per call   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Registers a background job to be run by the idle loop          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_IdleJobCreate(uint8_t Copy_JobId, uint8_t (*Copy_pJob)(void))
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pJob != NULL)
+	{
+		/* Check if passed job index is within valid range or not */
+		if(Copy_JobId < OS_NUM_OF_IDLE_JOBS)
+		{
+			Global_IdleJobsArr[Copy_JobId] = Copy_pJob;
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleJobDelete                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_JobId                                             */
+/*                 Brief: Index of the job to be removed                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Removes a background job from the idle loop                    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_IdleJobDelete(uint8_t Copy_JobId)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed job index is within valid range or not */
+	if(Copy_JobId < OS_NUM_OF_IDLE_JOBS)
+	{
+		Global_IdleJobsArr[Copy_JobId] = NULL;
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleRun                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs one slice of the next background job, to be called over   */
+/*                 and over from the while(1) loop of main()                      */
+/*--------------------------------------------------------------------------------*/
+void OS_IdleRun(void)
+{
+	/* Local Variables Definitions */
+	uint8_t (*Local_pJob)(void) = Global_IdleJobsArr[Global_IdleNextJob];
+
+	/* Run one slice of the job if its slot is used */
+	if(Local_pJob != NULL)
+	{
+		if(Local_pJob() == OS_IDLE_JOB_PENDING)
+		{
+			Global_IdleRoundPending = 1;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* Move to the next job, a full round ends after the last slot */
+	Global_IdleNextJob++;
+
+	if(Global_IdleNextJob == OS_NUM_OF_IDLE_JOBS)
+	{
+		Global_IdleNextJob = 0;
+
+		#if OS_IDLE_SLEEP == ENABLE
+
+			/* No job has work left for now, sleep until the next interrupt (at latest the next tick) */
+			if(Global_IdleRoundPending == 0)
+			{
+				OS_WAIT_FOR_INTERRUPT();
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+
+		#elif OS_IDLE_SLEEP == DISABLE
+
+			/* Keep spinning through the jobs */
+
+		#else
+
+			#error " Wrong OS_IDLE_SLEEP Configuration !"
+
+		#endif
+
+		Global_IdleRoundPending = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleFlashChecksumJob                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t (OS_IDLE_JOB_DONE once the whole image was summed)     */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Ready made background job summing OS_IDLE_CHECKSUM_SLICE words */
+/*                 of the flash image per call, pass it to OS_IdleJobCreate       */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_IdleFlashChecksumJob(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_JobStatus = OS_IDLE_JOB_PENDING;
+	uint16_t Local_WordCounter;			/* A variable to hold count of words summed in this slice */
+	const uint32_t* Local_pImageEnd;	/* A variable to hold end of the program image in flash */
+
+	/* The image ends after the initialized data copied to RAM at startup */
+	Local_pImageEnd = &_sidata + (&_edata - &_sdata);
+
+	/* Start a new pass from the beginning of the flash */
+	if(Global_pChecksumAddress == NULL)
+	{
+		Global_pChecksumAddress = (const uint32_t*)OS_FLASH_BASE_ADDRESS;
+		Global_ChecksumAccumulator = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* Sum a bounded slice of the image */
+	for(Local_WordCounter = 0 ; Local_WordCounter < OS_IDLE_CHECKSUM_SLICE && Global_pChecksumAddress < Local_pImageEnd ; Local_WordCounter++)
+	{
+		Global_ChecksumAccumulator += *Global_pChecksumAddress;
+		Global_pChecksumAddress++;
+	}
+
+	/* Publish the result once the whole image was summed */
+	if(Global_pChecksumAddress >= Local_pImageEnd)
+	{
+		Global_FlashChecksum = Global_ChecksumAccumulator;
+		Global_FlashChecksumPasses++;
+		Global_pChecksumAddress = NULL;
+		Local_JobStatus = OS_IDLE_JOB_DONE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return Local_JobStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_IdleGetFlashChecksum                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pChecksum                                       */
+/*                 Brief: Checksum of the flash image from the last full pass     */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pPasses                                         */
+/*                 Brief: Number of full passes completed (may be NULL)           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (RT_NOK if no full pass completed yet)          */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the result of the flash checksum background job           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_IdleGetFlashChecksum(uint32_t* Copy_pChecksum, uint32_t* Copy_pPasses)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_Passes = Global_FlashChecksumPasses;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pChecksum != NULL)
+	{
+		/* Check if a full pass was completed or not */
+		if(Local_Passes != 0)
+		{
+			*Copy_pChecksum = Global_FlashChecksum;
+
+			if(Copy_pPasses != NULL)
+			{
+				*Copy_pPasses = Local_Passes;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
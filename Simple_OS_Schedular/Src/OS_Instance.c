@@ -0,0 +1,340 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Instance                  */
+/*     			    Description	 : OS Instance Program File     */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Instance.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceInit                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : Task_t* Copy_pTasksArr                                         */
+/*                 Brief: Task table of the instance                              */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_NumOfTasks                                        */
+/*                 Brief: Number of task slots in the table                       */
+/*                 Range: (1 --> 32)                                              */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Policy                                            */
+/*                 Brief: OS_INSTANCE_PRIORITY or OS_INSTANCE_ROUND_ROBIN         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance to be initialized                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Initializes an instance with no task over the passed table     */
+/*                 (not needed for instances made with OS_SCHEDULAR_DEFINE)       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceInit(OS_Schedular_t* Copy_pInstance, Task_t* Copy_pTasksArr, uint8_t Copy_NumOfTasks, uint8_t Copy_Policy)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_TasksCounter;			/* A variable to hold task count */
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pInstance != NULL && Copy_pTasksArr != NULL)
+	{
+		/* Check if passed table size and policy are valid or not */
+		if(Copy_NumOfTasks != 0 && Copy_NumOfTasks <= 32U && Copy_Policy <= OS_INSTANCE_ROUND_ROBIN)
+		{
+			for(Local_TasksCounter = 0 ; Local_TasksCounter < Copy_NumOfTasks ; Local_TasksCounter++)
+			{
+				Copy_pTasksArr[Local_TasksCounter].TaskState = OS_TASK_DELETED;
+				Copy_pTasksArr[Local_TasksCounter].pDescriptor = NULL;
+			}
+
+			Copy_pInstance->pTasksArr = Copy_pTasksArr;
+			Copy_pInstance->NumOfTasks = Copy_NumOfTasks;
+			Copy_pInstance->Policy = Copy_Policy;
+			Copy_pInstance->RoundRobinNext = 0;
+			Copy_pInstance->TickCounter = 0;
+			Copy_pInstance->ReleaseMask = 0;
+			Copy_pInstance->ActiveMask = 0;
+			Copy_pInstance->PeriodicMask = 0;
+			Copy_pInstance->SelfTimedWaitingMask = 0;
+			Copy_pInstance->DeferredMask = 0;
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskCreate                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_TaskDescriptor_t* Copy_pDescriptor                    */
+/*                 Brief: Constant descriptor of the task (OS_INSTANCE_TASK),     */
+/*                        priority and periodicity counted in the instance, kept  */
+/*                        referenced by the task table                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task is created in                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task in an instance, first released one period plus  */
+/*                 offset from now                                                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskCreate(OS_Schedular_t* Copy_pInstance, const OS_TaskDescriptor_t* Copy_pDescriptor)
+{
+	return OS_SchedularTaskRegister(Copy_pInstance, Copy_pDescriptor);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskCreateSelfTimed                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t(*Copy_Fptr)(void)                                     */
+/*                 Brief: Task function, returns the instance ticks until its     */
+/*                        next release (0 is taken as 1) or OS_WAIT_FOR_EVENT     */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_FirstDelay                                       */
+/*                 Brief: Instance ticks until the first release or               */
+/*                        OS_WAIT_FOR_EVENT                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task is created in                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task with a variable period in an instance, each     */
+/*                 run sets the time of its next release                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskCreateSelfTimed(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority, uint32_t (*Copy_Fptr)(void), uint32_t Copy_FirstDelay)
+{
+	return OS_SchedularTaskCreateSelfTimed(Copy_pInstance, Copy_Priority, Copy_Fptr, Copy_FirstDelay);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskDelete                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Deletes a task of an instance and frees its slot               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskDelete(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority)
+{
+	return OS_SchedularTaskDelete(Copy_pInstance, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceReleaseTask                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Releases a task on the next tick of its instance, safe to be   */
+/*                 called from ISRs                                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceReleaseTask(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority)
+{
+	return OS_SchedularReleaseTask(Copy_pInstance, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskSuspend                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stops releasing a task of an instance until it is resumed      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskSuspend(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority)
+{
+	return OS_SchedularTaskSuspend(Copy_pInstance, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskResume                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes a suspended task of an instance on its original        */
+/*                 release grid                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskResume(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority)
+{
+	return OS_SchedularTaskResume(Copy_pInstance, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskChangePeriod                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task in the instance                    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: New periodicity in instance ticks, 0 for a task that    */
+/*                        only runs when released on demand                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Changes the periodicity of a task of an instance from its      */
+/*                 already planned next release                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskChangePeriod(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority, uint8_t Copy_Periodicity)
+{
+	return OS_SchedularTaskChangePeriod(Copy_pInstance, Copy_Priority, Copy_Periodicity);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTaskSetSuccessors                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the predecessor task in the instance        */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_SuccessorsMask                                   */
+/*                 Brief: One bit per task of the instance to be released once    */
+/*                        the predecessor completes, 0 for none                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance the task belongs to                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the tasks of an instance released in the same pass        */
+/*                 right after a task completes                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_InstanceTaskSetSuccessors(OS_Schedular_t* Copy_pInstance, uint8_t Copy_Priority, uint32_t Copy_SuccessorsMask)
+{
+	return OS_SchedularTaskSetSuccessors(Copy_pInstance, Copy_Priority, Copy_SuccessorsMask);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceTick                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pInstance                                 */
+/*                 Brief: Instance whose clock source ticked                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Schedular pass of an instance: counts the tick, releases its   */
+/*                 due tasks and runs every ready task with the instance policy   */
+/*--------------------------------------------------------------------------------*/
+void OS_InstanceTick(OS_Schedular_t* Copy_pInstance)
+{
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pInstance != NULL)
+	{
+		/* Same tick pass as the default kernel, on the instance state */
+		SCHEDULAR(Copy_pInstance);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_InstanceGetTickCount                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_Schedular_t* Copy_pInstance                           */
+/*                 Brief: Instance to be read                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t                                                       */
+/*                 Brief: Ticks of the instance so far (0 for a NULL instance)    */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the tick count of an instance                             */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_InstanceGetTickCount(const OS_Schedular_t* Copy_pInstance)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_TickCounter = 0;		/* A variable to hold tick count of the instance */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pInstance != NULL)
+	{
+		Local_TickCounter = Copy_pInstance->TickCounter;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return Local_TickCounter;
+}
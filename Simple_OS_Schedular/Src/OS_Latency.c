@@ -0,0 +1,323 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Latency                   */
+/*     			    Description	 : OS Latency Program File      */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "STK_Config.h"
+#include "STK_Interface.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Histogram.h"
+#include "OS_Latency.h"
+
+#if OS_INTERRUPT_LATENCY == ENABLE
+
+	#if OS_LATENCY_HISTOGRAMS != ENABLE
+
+		#error " OS_INTERRUPT_LATENCY Requires OS_LATENCY_HISTOGRAMS !"
+
+	#elif STK_ENTRY_CAPTURE != ENABLE
+
+		#error " OS_INTERRUPT_LATENCY Requires STK_ENTRY_CAPTURE !"
+
+	#elif OS_NUM_OF_LATENCY_SOURCES < OS_LATENCY_NUM_OF_OS_SOURCES || OS_NUM_OF_LATENCY_SOURCES > 255U
+
+		#error " Wrong OS_NUM_OF_LATENCY_SOURCES Configuration !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static OS_Histogram_t Global_LatencyHistogramsArr[OS_NUM_OF_LATENCY_SOURCES];	/* Latency histogram of every source */
+static uint32_t Global_LatencyExpiryCycle = 0;									/* Cycle count of the last SysTick expiry */
+static volatile uint8_t Global_LatencyDispatchPending = DISABLE;				/* Set until the first task of the tick pass starts */
+static volatile uint8_t Global_LatencyTickPended = DISABLE;					/* Set once the tick pass pended task IRQs (OS_PREEMPTIVE_SRP) */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyTickStart                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records the SysTick entry latency and takes the expiry time    */
+/*                 for the dispatch latency, called at the start of the tick pass */
+/*--------------------------------------------------------------------------------*/
+void OS_LatencyTickStart(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+	uint32_t Local_EntryCycle = 0;		/* A variable to hold cycle count at SysTick handler entry */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	/* Expiry and entry instants captured by SysTick_Handler before it touched the timer */
+	(void)STK_GetEntryCycles(&Global_LatencyExpiryCycle, &Local_EntryCycle);
+
+	OS_HistogramAdd(&Global_LatencyHistogramsArr[OS_LATENCY_SYSTICK_ENTRY], Local_EntryCycle - Global_LatencyExpiryCycle);
+	Global_LatencyDispatchPending = ENABLE;
+	Global_LatencyTickPended = DISABLE;
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyTickEnd                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Drops the dispatch latency of a tick that started no task and  */
+/*                 pended none, called at the end of the tick pass                */
+/*--------------------------------------------------------------------------------*/
+void OS_LatencyTickEnd(void)
+{
+	/* Task IRQs pended by the pass start once it returns, the first of them takes the sample */
+	if(Global_LatencyTickPended == DISABLE)
+	{
+		Global_LatencyDispatchPending = DISABLE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyTasksPended                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_PendedTasks                                      */
+/*                 Brief: One bit per task IRQ pended by the pass                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Keeps the dispatch latency of a tick pass that pended task     */
+/*                 IRQs until the first of them starts, called by the             */
+/*                 OS_PREEMPTIVE_SRP dispatch                                     */
+/*--------------------------------------------------------------------------------*/
+void OS_LatencyTasksPended(uint32_t Copy_PendedTasks)
+{
+	/* Only task IRQs pended by the tick pass itself carry its dispatch latency */
+	if(Global_LatencyDispatchPending == ENABLE && Copy_PendedTasks != 0)
+	{
+		Global_LatencyTickPended = ENABLE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyTaskStart                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records the dispatch latency if this is the first task run by  */
+/*                 the current tick pass, called by OS_ExecuteTask                */
+/*--------------------------------------------------------------------------------*/
+void OS_LatencyTaskStart(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	if(Global_LatencyDispatchPending == ENABLE)
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		OS_HistogramAdd(&Global_LatencyHistogramsArr[OS_LATENCY_TICK_DISPATCH], OS_CYCLE_COUNT() - Global_LatencyExpiryCycle);
+		Global_LatencyDispatchPending = DISABLE;
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyRecord                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Source                                            */
+/*                 Brief: Latency source of the calling interrupt handler         */
+/*                 Range: (OS_LATENCY_NUM_OF_OS_SOURCES -->                       */
+/*                         OS_NUM_OF_LATENCY_SOURCES - 1)                         */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_EventCycle                                       */
+/*                 Brief: Cycle count at which the interrupt event happened       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records the time from an interrupt event to now in the         */
+/*                 histogram of its source                                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LatencyRecord(uint8_t Copy_Source, uint32_t Copy_EventCycle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_CycleCount = OS_CYCLE_COUNT();	/* A variable to hold cycle count at the call */
+	uint32_t Local_InterruptsState;					/* A variable to hold interrupts state before entering critical section */
+
+	/* Check if passed source is one of the application sources or not */
+	if(Copy_Source >= OS_LATENCY_NUM_OF_OS_SOURCES && Copy_Source < OS_NUM_OF_LATENCY_SOURCES)
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+		OS_HistogramAdd(&Global_LatencyHistogramsArr[Copy_Source], Local_CycleCount - Copy_EventCycle);
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyRead                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Source                                            */
+/*                 Brief: Latency source                                          */
+/*                 Range: (0 --> OS_NUM_OF_LATENCY_SOURCES - 1)                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_Histogram_t* Copy_pHistogram                                */
+/*                 Brief: Copy of the latency histogram of the source             */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets a consistent copy of the latency histogram of a source    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LatencyRead(uint8_t Copy_Source, OS_Histogram_t* Copy_pHistogram)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pHistogram != NULL)
+	{
+		/* Check if passed source is valid or not */
+		if(Copy_Source < OS_NUM_OF_LATENCY_SOURCES)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+			*Copy_pHistogram = Global_LatencyHistogramsArr[Copy_Source];
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LatencyReset                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Source                                            */
+/*                 Brief: Latency source                                          */
+/*                 Range: (0 --> OS_NUM_OF_LATENCY_SOURCES - 1)                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Clears the latency histogram of a source                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LatencyReset(uint8_t Copy_Source)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+	uint8_t Local_BucketsCounter;		/* A variable to hold bucket count */
+
+	/* Check if passed source is valid or not */
+	if(Copy_Source < OS_NUM_OF_LATENCY_SOURCES)
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		Global_LatencyHistogramsArr[Copy_Source].Count = 0;
+
+		for(Local_BucketsCounter = 0 ; Local_BucketsCounter < OS_HISTOGRAM_NUM_OF_BUCKETS ; Local_BucketsCounter++)
+		{
+			Global_LatencyHistogramsArr[Copy_Source].BucketsArr[Local_BucketsCounter] = 0;
+		}
+
+		/* Min and max restart from the next recorded latency */
+		Global_LatencyHistogramsArr[Copy_Source].Min = 0;
+		Global_LatencyHistogramsArr[Copy_Source].Max = 0;
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+#elif OS_INTERRUPT_LATENCY != DISABLE
+
+	#error " Wrong OS_INTERRUPT_LATENCY Configuration !"
+
+#endif
@@ -0,0 +1,459 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Load                      */
+/*     			    Description	 : OS Load Program File         */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_CyclicTable.h"
+#include "OS_Load.h"
+
+#if OS_LOAD_ACCOUNTING == ENABLE
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Period of the tick pass in microseconds */
+#if OS_CYCLIC_EXECUTIVE == ENABLE
+	#define OS_LOAD_TICK_US				OS_CYCLIC_MINOR_FRAME_US
+#else
+	#define OS_LOAD_TICK_US				OS_TICK_PERIOD
+#endif
+
+/* Ticks and cycles of the 1 s window (one tick if the tick is longer than 1 s) */
+#define OS_LOAD_TICK_CYCLES				OS_US_TO_CYCLES(OS_LOAD_TICK_US)
+#define OS_LOAD_WINDOW_TICKS			((OS_LOAD_TICK_US >= 1000000UL) ? 1UL : (1000000UL / OS_LOAD_TICK_US))
+#define OS_LOAD_WINDOW_CYCLES			(OS_LOAD_WINDOW_TICKS * OS_LOAD_TICK_CYCLES)
+
+/* Number of windows weighting the 10 s and 60 s moving averages */
+#define OS_LOAD_WINDOW_US				(OS_LOAD_WINDOW_TICKS * OS_LOAD_TICK_US)
+#define OS_LOAD_EMA_10S_WINDOWS			((OS_LOAD_WINDOW_US >= 10000000UL) ? 1UL : (10000000UL / OS_LOAD_WINDOW_US))
+#define OS_LOAD_EMA_60S_WINDOWS			((OS_LOAD_WINDOW_US >= 60000000UL) ? 1UL : (60000000UL / OS_LOAD_WINDOW_US))
+
+/* Fraction bits of the moving averages */
+#define OS_LOAD_EMA_SHIFT				8U
+
+/* Largest divisor keeping a ratio numerator times OS_LOAD_FULL within 32 bits */
+#define OS_LOAD_MAX_DIVISOR				(0xFFFFFFFFUL / OS_LOAD_FULL)
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint8_t Global_LoadNesting = 0;				/* Number of busy sections (passes and tasks) currently entered */
+static uint32_t Global_LoadBusyStart = 0;			/* Cycle count at which the outermost busy section was entered */
+static uint32_t Global_LoadTickBusyCycles = 0;		/* Busy cycles of the current tick */
+static uint32_t Global_LoadWindowBusyCycles = 0;	/* Busy cycles of the current 1 s window */
+static uint32_t Global_LoadWindowTicks = 0;			/* Ticks elapsed in the current 1 s window */
+static uint32_t Global_LoadNestedCycles = 0;		/* Cycles of tasks that preempted the running task */
+static sint32_t Global_Load10sEma = 0;				/* 10 s moving average with OS_LOAD_EMA_SHIFT fraction bits */
+static sint32_t Global_Load60sEma = 0;				/* 60 s moving average with OS_LOAD_EMA_SHIFT fraction bits */
+static OS_LoadAverages_t Global_LoadAverages;		/* Loads reported by OS_LoadGetAverages */
+static uint32_t Global_LoadTaskCyclesArr[NUM_OF_TASKS];				/* Cycles spent in every task in the current 1 s window */
+static volatile uint16_t Global_LoadTaskShareArr[NUM_OF_TASKS];		/* Share of every task in the last 1 s window */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS PROTOTYPES                          */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void OS_LoadBusyBegin(uint32_t Copy_CycleCount);
+static void OS_LoadBusyEnd(uint32_t Copy_CycleCount);
+static uint16_t OS_LoadRatio(uint32_t Copy_Cycles, uint32_t Copy_TotalCycles);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadEnter                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Marks the entry of a schedular pass, called by the tick and    */
+/*                 event passes                                                   */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadEnter(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+	OS_LoadBusyBegin(OS_CYCLE_COUNT());
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadExit                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Marks the exit of a schedular pass, called by the tick and     */
+/*                 event passes                                                   */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadExit(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+	OS_LoadBusyEnd(OS_CYCLE_COUNT());
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadTaskStart                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_LoadTaskState_t* Copy_pState                                */
+/*                 Brief: Accounting state to be passed to OS_LoadTaskStop        */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Starts measuring a task, called by OS_ExecuteTask              */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadTaskStart(OS_LoadTaskState_t* Copy_pState)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+	uint32_t Local_CycleCount;			/* A variable to hold cycle count at dispatch */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Local_CycleCount = OS_CYCLE_COUNT();
+	OS_LoadBusyBegin(Local_CycleCount);
+
+	/* Count tasks preempting this one apart from the ones that preempted the task it preempts */
+	Copy_pState->OuterNestedCycles = Global_LoadNestedCycles;
+	Copy_pState->StartCycle = Local_CycleCount;
+	Global_LoadNestedCycles = 0;
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadTaskStop                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task that returned                      */
+/*                 -------------------------------------------------------------- */
+/*                 const OS_LoadTaskState_t* Copy_pState                          */
+/*                 Brief: Accounting state filled by OS_LoadTaskStart             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Charges the cycles spent in a task to it, called by            */
+/*                 OS_ExecuteTask                                                 */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadTaskStop(uint8_t Copy_Priority, const OS_LoadTaskState_t* Copy_pState)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+	uint32_t Local_CycleCount;			/* A variable to hold cycle count at return */
+	uint32_t Local_ElapsedCycles;		/* A variable to hold cycles from dispatch to return */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Local_CycleCount = OS_CYCLE_COUNT();
+	Local_ElapsedCycles = Local_CycleCount - Copy_pState->StartCycle;
+
+	/* Charge the task with its own cycles only, the whole elapsed time nests in the preempted task */
+	Global_LoadTaskCyclesArr[Copy_Priority] += Local_ElapsedCycles - Global_LoadNestedCycles;
+	Global_LoadNestedCycles = Copy_pState->OuterNestedCycles + Local_ElapsedCycles;
+
+	OS_LoadBusyEnd(Local_CycleCount);
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadTick                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Closes the load of the last tick and of the 1 s window once    */
+/*                 it is over, called by the tick pass                            */
+/*--------------------------------------------------------------------------------*/
+void OS_LoadTick(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+	uint32_t Local_CycleCount;			/* A variable to hold cycle count at the end of the tick */
+	uint32_t Local_BusyCycles;			/* A variable to hold busy cycles of the last tick */
+	uint16_t Local_WindowLoad;			/* A variable to hold load of the last 1 s window */
+	uint8_t Local_TasksCounter;			/* A variable to hold task count */
+
+	/* The tick pass is still running, split its busy time at this point */
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Local_CycleCount = OS_CYCLE_COUNT();
+	Local_BusyCycles = Global_LoadTickBusyCycles + (Local_CycleCount - Global_LoadBusyStart);
+	Global_LoadBusyStart = Local_CycleCount;
+	Global_LoadTickBusyCycles = 0;
+
+	Global_LoadAverages.Instant = OS_LoadRatio(Local_BusyCycles, OS_LOAD_TICK_CYCLES);
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+
+	Global_LoadWindowBusyCycles += Local_BusyCycles;
+	Global_LoadWindowTicks++;
+
+	/* Close the 1 s window once it is over */
+	if(Global_LoadWindowTicks >= OS_LOAD_WINDOW_TICKS)
+	{
+		Local_WindowLoad = OS_LoadRatio(Global_LoadWindowBusyCycles, OS_LOAD_WINDOW_CYCLES);
+		Global_LoadWindowBusyCycles = 0;
+		Global_LoadWindowTicks = 0;
+
+		/* Move both averages toward the load of the window */
+		Global_Load10sEma += (((sint32_t)Local_WindowLoad << OS_LOAD_EMA_SHIFT) - Global_Load10sEma) / (sint32_t)OS_LOAD_EMA_10S_WINDOWS;
+		Global_Load60sEma += (((sint32_t)Local_WindowLoad << OS_LOAD_EMA_SHIFT) - Global_Load60sEma) / (sint32_t)OS_LOAD_EMA_60S_WINDOWS;
+
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		Global_LoadAverages.Last1s = Local_WindowLoad;
+		Global_LoadAverages.Avg10s = (uint16_t)(Global_Load10sEma >> OS_LOAD_EMA_SHIFT);
+		Global_LoadAverages.Avg60s = (uint16_t)(Global_Load60sEma >> OS_LOAD_EMA_SHIFT);
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+
+		/* Take the cycles of every task, a task preempting this pass keeps charging the new window */
+		for(Local_TasksCounter = 0 ; Local_TasksCounter < NUM_OF_TASKS ; Local_TasksCounter++)
+		{
+			Global_LoadTaskShareArr[Local_TasksCounter] = OS_LoadRatio(OS_ATOMIC_EXCHANGE(&Global_LoadTaskCyclesArr[Local_TasksCounter], 0), OS_LOAD_WINDOW_CYCLES);
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadGetAverages                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_LoadAverages_t* Copy_pAverages                              */
+/*                 Brief: Instantaneous, 1 s, 10 s and 60 s loads                 */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets a consistent copy of the CPU loads                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LoadGetAverages(OS_LoadAverages_t* Copy_pAverages)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pAverages != NULL)
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+		*Copy_pAverages = Global_LoadAverages;
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadGetTaskShare                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint16_t* Copy_pShare                                          */
+/*                 Brief: Share of the last 1 s window spent in the task          */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the CPU utilization share of a task                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LoadGetTaskShare(uint8_t Copy_Priority, uint16_t* Copy_pShare)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pShare != NULL)
+	{
+		/* Check if passed priority belongs to a task in the system or not */
+		if(Copy_Priority < NUM_OF_TASKS)
+		{
+			*Copy_pShare = Global_LoadTaskShareArr[Copy_Priority];
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS IMPLEMENTATIONS                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadBusyBegin                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_CycleCount                                       */
+/*                 Brief: Cycle count at the entry of the busy section            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Enters a busy section, only the outermost one starts the busy  */
+/*                 time (called with interrupts masked)                           */
+/*--------------------------------------------------------------------------------*/
+static void OS_LoadBusyBegin(uint32_t Copy_CycleCount)
+{
+	if(Global_LoadNesting == 0)
+	{
+		Global_LoadBusyStart = Copy_CycleCount;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	Global_LoadNesting++;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadBusyEnd                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_CycleCount                                       */
+/*                 Brief: Cycle count at the exit of the busy section             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Exits a busy section, only the outermost one adds the busy     */
+/*                 time to the current tick (called with interrupts masked)       */
+/*--------------------------------------------------------------------------------*/
+static void OS_LoadBusyEnd(uint32_t Copy_CycleCount)
+{
+	Global_LoadNesting--;
+
+	if(Global_LoadNesting == 0)
+	{
+		Global_LoadTickBusyCycles += Copy_CycleCount - Global_LoadBusyStart;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LoadRatio                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_Cycles                                           */
+/*                 Brief: Busy cycles                                             */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_TotalCycles                                      */
+/*                 Brief: Cycles of the measured period (not 0)                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint16_t                                                       */
+/*                 Brief: Busy part of the period in hundredths of a percent      */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Computes a load without 64-bit arithmetic, saturated at        */
+/*                 OS_LOAD_FULL since a pass may start late in its tick           */
+/*--------------------------------------------------------------------------------*/
+static uint16_t OS_LoadRatio(uint32_t Copy_Cycles, uint32_t Copy_TotalCycles)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_Load;				/* A variable to hold the computed load */
+
+	/* Drop low bits of both terms until the scaled numerator fits in 32 bits */
+	while(Copy_TotalCycles > OS_LOAD_MAX_DIVISOR)
+	{
+		Copy_Cycles >>= 1;
+		Copy_TotalCycles >>= 1;
+	}
+
+	Local_Load = (Copy_Cycles >= Copy_TotalCycles) ? OS_LOAD_FULL : ((Copy_Cycles * OS_LOAD_FULL) / Copy_TotalCycles);
+
+	return (uint16_t)Local_Load;
+}
+
+#elif OS_LOAD_ACCOUNTING != DISABLE
+
+	#error " Wrong OS_LOAD_ACCOUNTING Configuration !"
+
+#endif
@@ -0,0 +1,201 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Log                       */
+/*     			    Description	 : OS Log Program File          */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Log.h"
+
+#if OS_BINARY_LOG == ENABLE
+
+	#if OS_LOG_NUM_OF_WORDS < 16U || OS_LOG_NUM_OF_WORDS > 65536U || (OS_LOG_NUM_OF_WORDS & (OS_LOG_NUM_OF_WORDS - 1U)) != 0
+
+		#error " Wrong OS_LOG_NUM_OF_WORDS Configuration !"
+
+	#endif
+
+	#if OS_LOG_LEVEL < OS_LOG_LEVEL_ERROR || OS_LOG_LEVEL > OS_LOG_LEVEL_DEBUG
+
+		#error " Wrong OS_LOG_LEVEL Configuration !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+OS_Log_t Global_LogData = {OS_LOG_NUM_OF_WORDS, 0, 0, 0, {0}};	/* Ring buffer dumped by the debugger or drained by OS_LogRead for Tools/log_decode.py */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LogWrite                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_FormatId                                         */
+/*                 Brief: Offset of the format string in .os_log_strings          */
+/*                 -------------------------------------------------------------- */
+/*                 const uint32_t* Copy_pArgs                                     */
+/*                 Brief: Arguments of the log call                               */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_NumOfArgs                                        */
+/*                 Brief: Number of arguments of the log call                     */
+/*                 Range: (0 --> OS_LOG_MAX_ARGS)                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Writes a log record, or counts it as dropped if the ring       */
+/*                 buffer is full, called by the OS_LOG macros only               */
+/*--------------------------------------------------------------------------------*/
+void OS_LogWrite(uint32_t Copy_FormatId, const uint32_t* Copy_pArgs, uint32_t Copy_NumOfArgs)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before the write */
+	uint32_t Local_WriteCount;			/* A variable to hold the index of the next word to write */
+	uint32_t Local_Counter;				/* A variable to be used as a counter */
+
+	/* Calls from interrupt handlers and preempting tasks must not interleave their words */
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Local_WriteCount = Global_LogData.WriteCount;
+
+	if((Local_WriteCount - Global_LogData.ReadCount) + OS_LOG_RECORD_HEADER_WORDS + Copy_NumOfArgs <= OS_LOG_NUM_OF_WORDS)
+	{
+		Global_LogData.WordsArr[Local_WriteCount & (OS_LOG_NUM_OF_WORDS - 1U)] = (Copy_FormatId << OS_LOG_ID_SHIFT) | Copy_NumOfArgs;
+		Global_LogData.WordsArr[(Local_WriteCount + 1U) & (OS_LOG_NUM_OF_WORDS - 1U)] = OS_CYCLE_COUNT();
+		Local_WriteCount += OS_LOG_RECORD_HEADER_WORDS;
+
+		for(Local_Counter = 0; Local_Counter < Copy_NumOfArgs; Local_Counter++)
+		{
+			Global_LogData.WordsArr[Local_WriteCount & (OS_LOG_NUM_OF_WORDS - 1U)] = Copy_pArgs[Local_Counter];
+			Local_WriteCount++;
+		}
+
+		/* Publish the record once it is whole */
+		Global_LogData.WriteCount = Local_WriteCount;
+	}
+	else
+	{
+		Global_LogData.DroppedCount++;
+	}
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LogRead                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_MaxNumOfWords                                    */
+/*                 Brief: Size of the words buffer                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pWords                                          */
+/*                 Brief: Buffer receiving the oldest whole records               */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pNumOfWords                                     */
+/*                 Brief: Number of words copied to the buffer                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Moves the oldest records fitting in the buffer out of the ring */
+/*                 buffer, to be sent to the host by a single reader              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_LogRead(uint32_t* Copy_pWords, uint32_t Copy_MaxNumOfWords, uint32_t* Copy_pNumOfWords)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_ReadCount;			/* A variable to hold the index of the next word to read */
+	uint32_t Local_WriteCount;			/* A variable to hold the number of words published by the writers */
+	uint32_t Local_RecordSize;			/* A variable to hold the number of words of the oldest record */
+	uint32_t Local_NumOfWords = 0;		/* A variable to hold the number of words copied so far */
+
+	if(Copy_pWords != NULL && Copy_pNumOfWords != NULL)
+	{
+		/* Writers only append behind WriteCount, the words before it are whole records */
+		Local_ReadCount = Global_LogData.ReadCount;
+		Local_WriteCount = Global_LogData.WriteCount;
+
+		while(Local_ReadCount != Local_WriteCount)
+		{
+			Local_RecordSize = OS_LOG_RECORD_HEADER_WORDS + (Global_LogData.WordsArr[Local_ReadCount & (OS_LOG_NUM_OF_WORDS - 1U)] & OS_LOG_NUM_OF_ARGS_MASK);
+
+			if(Local_NumOfWords + Local_RecordSize <= Copy_MaxNumOfWords)
+			{
+				for(; Local_RecordSize > 0U; Local_RecordSize--)
+				{
+					Copy_pWords[Local_NumOfWords] = Global_LogData.WordsArr[Local_ReadCount & (OS_LOG_NUM_OF_WORDS - 1U)];
+					Local_NumOfWords++;
+					Local_ReadCount++;
+				}
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		/* Free the copied words for the writers */
+		Global_LogData.ReadCount = Local_ReadCount;
+		*Copy_pNumOfWords = Local_NumOfWords;
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_LogReset                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Discards every record and clears the dropped records count     */
+/*--------------------------------------------------------------------------------*/
+void OS_LogReset(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before the reset */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Global_LogData.ReadCount = Global_LogData.WriteCount;
+	Global_LogData.DroppedCount = 0;
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+#elif OS_BINARY_LOG != DISABLE
+
+	#error " Wrong OS_BINARY_LOG Configuration !"
+
+#endif
@@ -0,0 +1,435 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Overload                  */
+/*     			    Description	 : OS Overload Program File     */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Overload.h"
+
+#if OS_OVERLOAD_MANAGEMENT == ENABLE
+
+	#if OS_SCHEDULING_MODE != OS_COOPERATIVE || OS_STATIC_TASK_SET != DISABLE || OS_CYCLIC_EXECUTIVE != DISABLE
+
+		#error " OS_OVERLOAD_MANAGEMENT Requires OS_COOPERATIVE Scheduling Mode With The Table Driven Schedular !"
+
+	#endif
+
+	#if OS_NUM_OF_CRITICALITY_LEVELS < 2 || OS_OVERLOAD_EXIT_LOAD >= OS_OVERLOAD_ENTER_LOAD
+
+		#error " Wrong OS_OVERLOAD_MANAGEMENT Levels Configuration !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	OS_TaskDescriptor_t DegradedDescriptor;			/* Body and periodicity while degraded (NULL body keeps the normal one) */
+	const OS_TaskDescriptor_t* pNormalDescriptor;	/* Descriptor saved while degraded */
+	uint8_t NormalPeriodicity;						/* Periodicity saved while degraded */
+	uint8_t Criticality;							/* Criticality level of the task */
+}OS_DegradedMode_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static OS_DegradedMode_t Global_DegradedModesArr[NUM_OF_TASKS];	/* Degraded mode of every task */
+static uint32_t Global_DegradableTasksMask = 0;					/* One bit per task given a degraded mode */
+static uint32_t Global_DegradedTasksMask = 0;					/* One bit per task running its degraded mode */
+static volatile uint8_t Global_OverloadLevel = 0;				/* Tasks with a lower criticality run degraded */
+static volatile uint8_t Global_OverloadLastLoad = 0;			/* Load of the last tick pass in percent */
+static volatile uint32_t Global_OverloadOverrunCount = 0;		/* Tick passes still running when the next tick was due */
+static uint8_t Global_OverloadHoldCounter = 0;					/* Passes since the last raise of the level */
+static uint8_t Global_OverloadExitCounter = 0;					/* Passes in a row below the exit load */
+
+extern Task_t Global_TasksArr[NUM_OF_TASKS];
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS PROTOTYPES                          */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void OS_OverloadSetLevel(uint8_t Copy_Level);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetCriticality                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Criticality                                       */
+/*                 Brief: Criticality level of the task                           */
+/*                 Range: (0 --> OS_NUM_OF_CRITICALITY_LEVELS - 1)                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the criticality of a task, taken into account on the next */
+/*                 change of the overload level                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetCriticality(uint8_t Copy_Priority, uint8_t Copy_Criticality)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed priority belongs to a task in the system and passed criticality is a valid level or not */
+	if(Copy_Priority < NUM_OF_TASKS && Copy_Criticality < OS_NUM_OF_CRITICALITY_LEVELS)
+	{
+		Global_DegradedModesArr[Copy_Priority].Criticality = Copy_Criticality;
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetDegradedMode                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 -------------------------------------------------------------- */
+/*                 void(*Copy_Fptr)(void)                                         */
+/*                 Brief: Body run while degraded (NULL keeps the normal body)    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: Periodicity while degraded (0 sheds periodic releases)  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gives a task a degraded mode used under overload, must be set  */
+/*                 while the system is not overloaded                             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetDegradedMode(uint8_t Copy_Priority, void(*Copy_Fptr)(void), uint8_t Copy_Periodicity)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before entering critical section */
+
+	/* Check if passed priority belongs to a task in the system or not */
+	if(Copy_Priority < NUM_OF_TASKS)
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		/* A task already running degraded would be restored to the wrong mode */
+		if(!GET_BIT(Global_DegradedTasksMask, Copy_Priority))
+		{
+			Global_DegradedModesArr[Copy_Priority].DegradedDescriptor.pFunction = Copy_Fptr;
+			Global_DegradedModesArr[Copy_Priority].DegradedDescriptor.Priority = Copy_Priority;
+			Global_DegradedModesArr[Copy_Priority].DegradedDescriptor.Periodicity = Copy_Periodicity;
+			Global_DegradedModesArr[Copy_Priority].DegradedDescriptor.Offset = 0;
+			SET_BIT(Global_DegradableTasksMask, Copy_Priority);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_OverloadGetStatus                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint8_t* Copy_pLevel                                           */
+/*                 Brief: Current overload level (0 if not overloaded)            */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t* Copy_pLoad                                            */
+/*                 Brief: Load of the last tick pass in percent (may be NULL)     */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pOverrunCount                                   */
+/*                 Brief: Tick passes still running when the next tick was due    */
+/*                        (may be NULL)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the overload state of the system                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_OverloadGetStatus(uint8_t* Copy_pLevel, uint8_t* Copy_pLoad, uint32_t* Copy_pOverrunCount)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pLevel != NULL)
+	{
+		*Copy_pLevel = Global_OverloadLevel;
+
+		if(Copy_pLoad != NULL)
+		{
+			*Copy_pLoad = Global_OverloadLastLoad;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		if(Copy_pOverrunCount != NULL)
+		{
+			*Copy_pOverrunCount = Global_OverloadOverrunCount;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_OverloadUpdate                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_PassCycles                                       */
+/*                 Brief: CPU cycles taken by the tick pass that just ended       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Checks the load of the tick pass and raises or drops the       */
+/*                 overload level, called by the tick pass when                   */
+/*                 OS_OVERLOAD_MANAGEMENT is enabled                              */
+/*--------------------------------------------------------------------------------*/
+void OS_OverloadUpdate(uint32_t Copy_PassCycles)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_Load;			/* A variable to hold load of the pass in percent */
+	uint8_t Local_Overrun = 0;		/* A variable to hold whether the pass ran into the next tick */
+
+	Local_Load = Copy_PassCycles / (OS_US_TO_CYCLES(OS_TICK_PERIOD) / 100UL);
+	Global_OverloadLastLoad = (Local_Load > 255UL) ? 255U : (uint8_t)Local_Load;
+
+	/* The next tick is already pending if the tasks of this pass ran past its end */
+	if(GET_BIT(SCB_ICSR, SCB_ICSR_PENDSTSET))
+	{
+		Global_OverloadOverrunCount++;
+		Local_Overrun = 1;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(Global_OverloadHoldCounter < 255U)
+	{
+		Global_OverloadHoldCounter++;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	if(Local_Overrun || Local_Load >= OS_OVERLOAD_ENTER_LOAD)
+	{
+		Global_OverloadExitCounter = 0;
+
+		/* Degrade one more criticality level once the previous one had time to take effect */
+		if(Global_OverloadLevel < (OS_NUM_OF_CRITICALITY_LEVELS - 1U) && Global_OverloadHoldCounter >= OS_OVERLOAD_HOLD_TICKS)
+		{
+			Global_OverloadHoldCounter = 0;
+			OS_OverloadSetLevel((uint8_t)(Global_OverloadLevel + 1U));
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else if(Local_Load <= OS_OVERLOAD_EXIT_LOAD && Global_OverloadLevel != 0)
+	{
+		/* Restore one criticality level after enough quiet passes in a row */
+		Global_OverloadExitCounter++;
+
+		if(Global_OverloadExitCounter >= OS_OVERLOAD_EXIT_TICKS)
+		{
+			Global_OverloadExitCounter = 0;
+			OS_OverloadSetLevel((uint8_t)(Global_OverloadLevel - 1U));
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Load between both thresholds, keep the current level */
+		Global_OverloadExitCounter = 0;
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_OverloadTaskReset                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task deleted or created again           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Puts the normal descriptor of a degraded task back in its slot */
+/*                 and forgets its degraded state, called by the schedular before */
+/*                 a task is deleted or created again                             */
+/*--------------------------------------------------------------------------------*/
+void OS_OverloadTaskReset(uint8_t Copy_Priority)
+{
+	/* Check if the task runs its degraded mode or not */
+	if(Copy_Priority < NUM_OF_TASKS && GET_BIT(Global_DegradedTasksMask, Copy_Priority))
+	{
+		/* The slot must give back the descriptor it was created with, not the degraded copy */
+		if(Global_TasksArr[Copy_Priority].pDescriptor == &Global_DegradedModesArr[Copy_Priority].DegradedDescriptor)
+		{
+			Global_TasksArr[Copy_Priority].pDescriptor = Global_DegradedModesArr[Copy_Priority].pNormalDescriptor;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		CLEAR_BIT(Global_DegradedTasksMask, Copy_Priority);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS IMPLEMENTATIONS                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_OverloadSetLevel                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Level                                             */
+/*                 Brief: New overload level                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Switches every degradable task to the mode matching the new    */
+/*                 level, from the next pass on                                   */
+/*--------------------------------------------------------------------------------*/
+static void OS_OverloadSetLevel(uint8_t Copy_Level)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_Tasks = Global_DegradableTasksMask;	/* A variable to hold degradable tasks still to be checked */
+	uint8_t Local_TaskPriority;							/* A variable to hold priority of the task being checked */
+	OS_DegradedMode_t* Local_pMode;						/* A variable to hold degraded mode of the task being checked */
+
+	Global_OverloadLevel = Copy_Level;
+
+	while(Local_Tasks != 0)
+	{
+		Local_TaskPriority = (uint8_t)__builtin_ctzl(Local_Tasks);
+		CLEAR_BIT(Local_Tasks, Local_TaskPriority);
+		Local_pMode = &Global_DegradedModesArr[Local_TaskPriority];
+
+		if(Local_pMode->Criticality < Copy_Level && !GET_BIT(Global_DegradedTasksMask, Local_TaskPriority))
+		{
+			/* Save the normal mode then switch to the degraded one */
+			Local_pMode->pNormalDescriptor = Global_TasksArr[Local_TaskPriority].pDescriptor;
+			Local_pMode->NormalPeriodicity = Global_TasksArr[Local_TaskPriority].TaskPeriodicity;
+
+			if(Local_pMode->DegradedDescriptor.pFunction != NULL)
+			{
+				Global_TasksArr[Local_TaskPriority].pDescriptor = &Local_pMode->DegradedDescriptor;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+
+			(void)OS_TaskChangePeriod(Local_TaskPriority, Local_pMode->DegradedDescriptor.Periodicity);
+			SET_BIT(Global_DegradedTasksMask, Local_TaskPriority);
+		}
+		else if(Local_pMode->Criticality >= Copy_Level && GET_BIT(Global_DegradedTasksMask, Local_TaskPriority))
+		{
+			/* Back to the saved normal mode, unless the slot got another descriptor meanwhile */
+			if(Global_TasksArr[Local_TaskPriority].pDescriptor == &Local_pMode->DegradedDescriptor)
+			{
+				Global_TasksArr[Local_TaskPriority].pDescriptor = Local_pMode->pNormalDescriptor;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+
+			(void)OS_TaskChangePeriod(Local_TaskPriority, Local_pMode->NormalPeriodicity);
+			CLEAR_BIT(Global_DegradedTasksMask, Local_TaskPriority);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+}
+
+#elif OS_OVERLOAD_MANAGEMENT != DISABLE
+
+	#error " Wrong OS_OVERLOAD_MANAGEMENT Configuration !"
+
+#endif
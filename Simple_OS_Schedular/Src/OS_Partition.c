@@ -0,0 +1,384 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Partition                 */
+/*     			    Description	 : OS Partition Program File    */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Budget.h"
+#include "OS_Partition.h"
+
+#if OS_PARTITIONING == ENABLE
+
+	#if OS_SCHEDULING_MODE != OS_COOPERATIVE || OS_STATIC_TASK_SET != DISABLE || OS_CYCLIC_EXECUTIVE != DISABLE
+
+		#error " OS_PARTITIONING Requires OS_COOPERATIVE Scheduling Mode With The Table Driven Schedular !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Pick one field of every listed partition */
+#define OS_PARTITION_WINDOW(Copy_WindowTicks,Copy_TasksMask,Copy_Policy)	(Copy_WindowTicks),
+#define OS_PARTITION_TASKS(Copy_WindowTicks,Copy_TasksMask,Copy_Policy)		(Copy_TasksMask),
+#define OS_PARTITION_POLICY(Copy_WindowTicks,Copy_TasksMask,Copy_Policy)	(Copy_Policy),
+
+/* Sum and union of the tasks masks, equal only if no task belongs to two partitions */
+#define OS_PARTITION_SUM(Copy_WindowTicks,Copy_TasksMask,Copy_Policy)		+ (unsigned long long)(Copy_TasksMask)
+#define OS_PARTITION_UNION(Copy_WindowTicks,Copy_TasksMask,Copy_Policy)		| (Copy_TasksMask)
+
+/* Every window is measured in 32 bit CPU cycles */
+#define OS_PARTITION_WINDOW_CYCLES(Copy_WindowTicks,Copy_TasksMask,Copy_Policy)	\
+		_Static_assert((unsigned long long)(Copy_WindowTicks) * OS_TICK_PERIOD * (OS_CPU_CLOCK_HZ / 1000000UL) <= 0xFFFFFFFFULL, "A partition window is too long to be measured in CPU cycles");
+
+_Static_assert((0 OS_PARTITION_LIST(OS_PARTITION_SUM)) == (0UL OS_PARTITION_LIST(OS_PARTITION_UNION)), "A task belongs to two partitions");
+_Static_assert(((0UL OS_PARTITION_LIST(OS_PARTITION_UNION)) & ~OS_ALL_TASKS_MASK) == 0, "A partition lists a task not in the system");
+_Static_assert((0UL OS_PARTITION_LIST(OS_PARTITION_UNION)) == OS_ALL_TASKS_MASK, "A task belongs to no partition and would never run");
+OS_PARTITION_LIST(OS_PARTITION_WINDOW_CYCLES)
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static const uint32_t Global_PartitionWindowsArr[] = { OS_PARTITION_LIST(OS_PARTITION_WINDOW) };	/* Window length of every partition in OS ticks */
+static const uint32_t Global_PartitionTasksArr[] = { OS_PARTITION_LIST(OS_PARTITION_TASKS) };		/* Tasks of every partition */
+static const uint8_t Global_PartitionPoliciesArr[] = { OS_PARTITION_LIST(OS_PARTITION_POLICY) };	/* Policy of every partition */
+
+#define OS_NUM_OF_PARTITIONS	(sizeof(Global_PartitionWindowsArr) / sizeof(Global_PartitionWindowsArr[0]))
+
+static volatile uint8_t Global_PartitionActive = 0;			/* Partition owning the current window */
+static uint32_t Global_PartitionTicksLeft = 0;				/* Ticks left in the current window */
+static uint32_t Global_PartitionWindowStart = 0;			/* Cycle count at which the current window opened */
+static uint32_t Global_PartitionBusyCycles = 0;				/* Cycles spent running tasks in the current window */
+static uint8_t Global_PartitionOverrunFlag = 0;				/* A task ran past the end of the current window */
+static uint32_t Global_PartitionHeldMask = 0;				/* One bit per released task waiting for its window */
+static uint8_t Global_PartitionRoundRobinArr[OS_NUM_OF_PARTITIONS];			/* First task to be tried by every round robin partition */
+static volatile uint8_t Global_PartitionUtilizationArr[OS_NUM_OF_PARTITIONS];	/* Utilization of the last window of every partition */
+static volatile uint32_t Global_PartitionOverrunsArr[OS_NUM_OF_PARTITIONS];		/* Overrun windows of every partition */
+static volatile uint32_t Global_PartitionDeferredArr[OS_NUM_OF_PARTITIONS];		/* Releases deferred at the end of a window of every partition */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS PROTOTYPES                          */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint8_t OS_PartitionPickTask(uint8_t Copy_PartitionId, uint32_t Copy_RunnableTasks);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionInit                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Opens the window of the first partition, called by OS_Init     */
+/*                 when OS_PARTITIONING is enabled                                */
+/*--------------------------------------------------------------------------------*/
+void OS_PartitionInit(void)
+{
+	Global_PartitionActive = 0;
+	Global_PartitionTicksLeft = Global_PartitionWindowsArr[0];
+	Global_PartitionWindowStart = OS_CYCLE_COUNT();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionTick                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Moves to the window of the next partition once the current one */
+/*                 is over, called by the tick pass before SCHEDULAR              */
+/*--------------------------------------------------------------------------------*/
+void OS_PartitionTick(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Partition = Global_PartitionActive;	/* A variable to hold the partition whose window may be over */
+	uint32_t Local_WindowCycles;						/* A variable to hold length of its window in CPU cycles */
+
+	Global_PartitionTicksLeft--;
+
+	if(Global_PartitionTicksLeft == 0)
+	{
+		/* Report how much of the closed window the partition used */
+		Local_WindowCycles = OS_US_TO_CYCLES(Global_PartitionWindowsArr[Local_Partition] * OS_TICK_PERIOD);
+		Global_PartitionUtilizationArr[Local_Partition] = (uint8_t)((Global_PartitionBusyCycles >= Local_WindowCycles) ? 100U :
+																	 (Global_PartitionBusyCycles / (Local_WindowCycles / 100UL)));
+
+		if(Global_PartitionOverrunFlag)
+		{
+			Global_PartitionOverrunsArr[Local_Partition]++;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		/* Open the window of the next partition, the major frame restarts after the last one */
+		Local_Partition = (Local_Partition + 1U == OS_NUM_OF_PARTITIONS) ? 0U : (uint8_t)(Local_Partition + 1U);
+
+		Global_PartitionActive = Local_Partition;
+		Global_PartitionTicksLeft = Global_PartitionWindowsArr[Local_Partition];
+		Global_PartitionWindowStart = OS_CYCLE_COUNT();
+		Global_PartitionBusyCycles = 0;
+		Global_PartitionOverrunFlag = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionDispatch                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_ReadyTasks                                       */
+/*                 Brief: One bit per released task (bit number = task priority)  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs the ready tasks of the partition owning the current       */
+/*                 window with its policy and keeps the other releases, called by */
+/*                 the schedular passes                                           */
+/*--------------------------------------------------------------------------------*/
+void OS_PartitionDispatch(uint32_t Copy_ReadyTasks)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Partition = Global_PartitionActive;		/* A variable to hold partition owning the window */
+	uint32_t Local_WindowCycles;							/* A variable to hold length of the window in CPU cycles */
+	uint32_t Local_RunnableTasks;							/* A variable to hold ready tasks of the partition */
+	uint32_t Local_StartCycle;								/* A variable to hold cycle count before the task being run */
+	uint32_t Local_SkippedTasks = 0;						/* A variable to hold tasks whose budget does not fit in the rest of the window */
+	uint8_t Local_TaskPriority;								/* A variable to hold priority of the task being run */
+	uint8_t Local_TaskFits = 1;								/* A variable to hold whether the picked task may be started */
+
+	#if OS_BUDGET_ENFORCEMENT == ENABLE
+
+		uint16_t Local_BudgetUs = 0;						/* A variable to hold CPU budget of the picked task */
+
+	#endif
+
+	Local_WindowCycles = OS_US_TO_CYCLES(Global_PartitionWindowsArr[Local_Partition] * OS_TICK_PERIOD);
+
+	/* Every release waits for the window of its partition */
+	Global_PartitionHeldMask |= Copy_ReadyTasks;
+	Local_RunnableTasks = Global_PartitionHeldMask & Global_PartitionTasksArr[Local_Partition];
+
+	while(Local_RunnableTasks != 0)
+	{
+		Local_StartCycle = OS_CYCLE_COUNT();
+
+		/* No task is started once the window is over, the rest waits for the next window */
+		if((Local_StartCycle - Global_PartitionWindowStart) >= Local_WindowCycles)
+		{
+			Global_PartitionDeferredArr[Local_Partition] += (uint32_t)__builtin_popcountl(Local_RunnableTasks);
+			break;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		Local_TaskPriority = OS_PartitionPickTask(Local_Partition, Local_RunnableTasks);
+
+		#if OS_BUDGET_ENFORCEMENT == ENABLE
+
+			/* A task whose budget does not fit in the rest of the window could run into the next one */
+			(void)OS_TaskGetBudget(Local_TaskPriority, &Local_BudgetUs);
+			Local_TaskFits = (OS_US_TO_CYCLES((uint32_t)Local_BudgetUs) <= (Local_WindowCycles - (Local_StartCycle - Global_PartitionWindowStart)));
+
+		#endif
+
+		if(Local_TaskFits)
+		{
+			CLEAR_BIT(Global_PartitionHeldMask, Local_TaskPriority);
+
+			/* Successors of the completed task wait for the window of their own partition (chains) */
+			Global_PartitionHeldMask |= OS_ExecuteTask(Local_TaskPriority);
+
+			Global_PartitionBusyCycles += OS_CYCLE_COUNT() - Local_StartCycle;
+
+			if((OS_CYCLE_COUNT() - Global_PartitionWindowStart) > Local_WindowCycles)
+			{
+				Global_PartitionOverrunFlag = 1;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* The task stays held for the next window, smaller tasks may still use the rest of this one */
+			SET_BIT(Local_SkippedTasks, Local_TaskPriority);
+			Global_PartitionDeferredArr[Local_Partition]++;
+		}
+
+		Local_RunnableTasks = Global_PartitionHeldMask & Global_PartitionTasksArr[Local_Partition] & ~Local_SkippedTasks;
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionGetActive                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t                                                        */
+/*                 Brief: Index of the partition owning the current window        */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the partition owning the current window                   */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_PartitionGetActive(void)
+{
+	return Global_PartitionActive;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionGetStats                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_PartitionId                                       */
+/*                 Brief: Index of the partition in OS_PARTITION_LIST             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_PartitionStats_t* Copy_pStats                               */
+/*                 Brief: Window, tasks, policy and run time statistics           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the window and the utilization of a partition             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_PartitionGetStats(uint8_t Copy_PartitionId, OS_PartitionStats_t* Copy_pStats)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_PartitionCounter;		/* A variable to hold count of partitions before the passed one */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pStats != NULL)
+	{
+		/* Check if passed partition is listed or not */
+		if(Copy_PartitionId < OS_NUM_OF_PARTITIONS)
+		{
+			Copy_pStats->WindowOffset = 0;
+
+			for(Local_PartitionCounter = 0 ; Local_PartitionCounter < Copy_PartitionId ; Local_PartitionCounter++)
+			{
+				Copy_pStats->WindowOffset += Global_PartitionWindowsArr[Local_PartitionCounter];
+			}
+
+			Copy_pStats->WindowLength = Global_PartitionWindowsArr[Copy_PartitionId];
+			Copy_pStats->TasksMask = Global_PartitionTasksArr[Copy_PartitionId];
+			Copy_pStats->Policy = Global_PartitionPoliciesArr[Copy_PartitionId];
+			Copy_pStats->Utilization = Global_PartitionUtilizationArr[Copy_PartitionId];
+			Copy_pStats->Overruns = Global_PartitionOverrunsArr[Copy_PartitionId];
+			Copy_pStats->DeferredJobs = Global_PartitionDeferredArr[Copy_PartitionId];
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS IMPLEMENTATIONS                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PartitionPickTask                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_PartitionId                                       */
+/*                 Brief: Partition owning the window                             */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_RunnableTasks                                    */
+/*                 Brief: Ready tasks of the partition (not 0)                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t                                                        */
+/*                 Brief: Priority of the next task to be run                     */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Picks the next task to be run according to the partition       */
+/*                 policy                                                         */
+/*--------------------------------------------------------------------------------*/
+static uint8_t OS_PartitionPickTask(uint8_t Copy_PartitionId, uint32_t Copy_RunnableTasks)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_TaskPriority;			/* A variable to hold priority of the picked task */
+	uint32_t Local_NextTasks;			/* A variable to hold ready tasks at or after the round robin position */
+
+	if(Global_PartitionPoliciesArr[Copy_PartitionId] == OS_PARTITION_ROUND_ROBIN)
+	{
+		/* First ready task from the round robin position, wrapping to the highest priority one */
+		Local_NextTasks = Copy_RunnableTasks & ~((1UL << Global_PartitionRoundRobinArr[Copy_PartitionId]) - 1UL);
+		Local_TaskPriority = (uint8_t)__builtin_ctzl((Local_NextTasks != 0) ? Local_NextTasks : Copy_RunnableTasks);
+
+		Global_PartitionRoundRobinArr[Copy_PartitionId] = (Local_TaskPriority + 1U >= NUM_OF_TASKS) ? 0U : (uint8_t)(Local_TaskPriority + 1U);
+	}
+	else
+	{
+		/* Highest priority ready task (lowest bit number) */
+		Local_TaskPriority = (uint8_t)__builtin_ctzl(Copy_RunnableTasks);
+	}
+
+	return Local_TaskPriority;
+}
+
+#elif OS_PARTITIONING != DISABLE
+
+	#error " Wrong OS_PARTITIONING Configuration !"
+
+#endif
@@ -0,0 +1,290 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Profiler                  */
+/*     			    Description	 : OS Profiler Program File     */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "RCC_Interface.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Profiler.h"
+
+#if OS_PROFILER == ENABLE
+
+	#if OS_PROFILER_SAMPLE_RATE_HZ < 16UL || OS_PROFILER_SAMPLE_RATE_HZ > 100000UL
+
+		#error " Wrong OS_PROFILER_SAMPLE_RATE_HZ Configuration !"
+
+	#endif
+
+	#if OS_PROFILER_NUM_OF_BUCKETS == 0 || OS_PROFILER_NUM_OF_BUCKETS > 65535U
+
+		#error " Wrong OS_PROFILER_NUM_OF_BUCKETS Configuration !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+OS_Profile_t Global_ProfilerData;	/* Profile dumped by the debugger for Tools/profile_report.py */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS PROTOTYPES                          */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void OS_ProfilerSample(const uint32_t* Copy_pFrame) __attribute__((used));
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerInit                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets up the sampling timer and its interrupt and starts        */
+/*                 sampling, called by OS_Init when OS_PROFILER is enabled        */
+/*--------------------------------------------------------------------------------*/
+void OS_ProfilerInit(void)
+{
+	/* Describe the buckets for the host tool */
+	Global_ProfilerData.BaseAddress = OS_FLASH_BASE_ADDRESS;
+	Global_ProfilerData.BucketShift = OS_PROFILER_BUCKET_SHIFT;
+	Global_ProfilerData.NumOfBuckets = OS_PROFILER_NUM_OF_BUCKETS;
+
+	RCC_EnablePeripheralClk(RCC_APB1, RCC_TIM3);
+
+	/* Update event every sampling period counted at 1 MHz */
+	OS_PROFILER_TIMER->PSC = (OS_CPU_CLOCK_HZ / 1000000UL) - 1UL;
+	OS_PROFILER_TIMER->ARR = (1000000UL / OS_PROFILER_SAMPLE_RATE_HZ) - 1UL;
+	OS_PROFILER_TIMER->EGR = (1UL << TIM_EGR_UG);
+	OS_PROFILER_TIMER->SR = 0;
+	OS_PROFILER_TIMER->DIER = (1UL << TIM_DIER_UIE);
+
+	/* Highest priority, so that tasks and kernel handlers are sampled alike */
+	NVIC_IPR[OS_PROFILER_TIMER_IRQ] = 0;
+	NVIC_ISER[OS_PROFILER_TIMER_IRQ >> 5] = (1UL << (OS_PROFILER_TIMER_IRQ & 0x1FU));
+
+	OS_ProfilerStart();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerStart                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes sampling, the samples taken so far are kept            */
+/*--------------------------------------------------------------------------------*/
+void OS_ProfilerStart(void)
+{
+	SET_BIT(OS_PROFILER_TIMER->CR1, TIM_CR1_CEN);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerStop                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stops sampling, so that the profile of one phase of the        */
+/*                 application can be read                                        */
+/*--------------------------------------------------------------------------------*/
+void OS_ProfilerStop(void)
+{
+	CLEAR_BIT(OS_PROFILER_TIMER->CR1, TIM_CR1_CEN);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerReset                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Clears every sample count, sampling is left stopped            */
+/*--------------------------------------------------------------------------------*/
+void OS_ProfilerReset(void)
+{
+	/* Local Variables Definitions */
+	uint16_t Local_BucketCounter;		/* A variable to hold count of cleared buckets */
+
+	OS_ProfilerStop();
+
+	for(Local_BucketCounter = 0 ; Local_BucketCounter < OS_PROFILER_NUM_OF_BUCKETS ; Local_BucketCounter++)
+	{
+		Global_ProfilerData.BucketsArr[Local_BucketCounter] = 0;
+	}
+
+	Global_ProfilerData.SamplesCount = 0;
+	Global_ProfilerData.OutOfRangeCount = 0;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerGetBucket                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint16_t Copy_BucketIndex                                      */
+/*                 Brief: Index of the bucket                                     */
+/*                 Range: (0 --> OS_PROFILER_NUM_OF_BUCKETS - 1)                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pAddress                                        */
+/*                 Brief: Code address of the start of the bucket                 */
+/*                 -------------------------------------------------------------- */
+/*                 uint16_t* Copy_pCount                                          */
+/*                 Brief: Number of samples counted in the bucket                 */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets one bucket of the profile, so that the application can    */
+/*                 stream it out without a debugger                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ProfilerGetBucket(uint16_t Copy_BucketIndex, uint32_t* Copy_pAddress, uint16_t* Copy_pCount)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pAddress != NULL && Copy_pCount != NULL)
+	{
+		/* Check if passed index belongs to a bucket or not */
+		if(Copy_BucketIndex < OS_PROFILER_NUM_OF_BUCKETS)
+		{
+			*Copy_pAddress = OS_FLASH_BASE_ADDRESS + ((uint32_t)Copy_BucketIndex << OS_PROFILER_BUCKET_SHIFT);
+			*Copy_pCount = Global_ProfilerData.BucketsArr[Copy_BucketIndex];
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                          PRIVATE FUNCTIONS IMPLEMENTATIONS                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ProfilerSample                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const uint32_t* Copy_pFrame                                    */
+/*                 Brief: Exception frame stacked on entry of the sampling        */
+/*                        interrupt                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Counts the interrupted program counter in its bucket           */
+/*--------------------------------------------------------------------------------*/
+static void OS_ProfilerSample(const uint32_t* Copy_pFrame)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_BucketIndex;		/* A variable to hold bucket of the interrupted instruction */
+
+	CLEAR_BIT(OS_PROFILER_TIMER->SR, TIM_SR_UIF);
+
+	/* Addresses below the flash wrap around to a huge index and are counted out of range */
+	Local_BucketIndex = (Copy_pFrame[OS_EXCEPTION_FRAME_PC] - OS_FLASH_BASE_ADDRESS) >> OS_PROFILER_BUCKET_SHIFT;
+
+	if(Local_BucketIndex < OS_PROFILER_NUM_OF_BUCKETS)
+	{
+		Global_ProfilerData.BucketsArr[Local_BucketIndex]++;
+
+		/* Stop before a count wraps, the profile stays consistent */
+		if(Global_ProfilerData.BucketsArr[Local_BucketIndex] == OS_PROFILER_BUCKET_MAX)
+		{
+			OS_ProfilerStop();
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		Global_ProfilerData.OutOfRangeCount++;
+	}
+
+	Global_ProfilerData.SamplesCount++;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            	  INTERRUPT HANDLERS		                    	 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: TIM3 Handler, passes the stack holding the exception frame      */
+/*                (MSP or PSP as told by EXC_RETURN bit 2) to the sampler         */
+/*--------------------------------------------------------------------------------*/
+__attribute__((naked)) void TIM3_IRQHandler(void)
+{
+	__asm volatile
+	(
+		"TST    lr, #4              \n\t"
+		"ITE    EQ                  \n\t"
+		"MRSEQ  r0, MSP             \n\t"
+		"MRSNE  r0, PSP             \n\t"
+		"B      OS_ProfilerSample   \n\t"
+	);
+}
+
+#elif OS_PROFILER != DISABLE
+
+	#error " Wrong OS_PROFILER Configuration !"
+
+#endif
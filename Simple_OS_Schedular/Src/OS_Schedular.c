@@ -17,7 +17,21 @@
 
 #include "STK_Interface.h"
 
+#include "OS_Config.h"
+#include "OS_Private.h"
 #include "OS_Schedular.h"
+#include "OS_Srp.h"
+#include "OS_Stack.h"
+#include "OS_StaticSchedular.h"
+#include "OS_Cyclic.h"
+#include "OS_CyclicTable.h"
+#include "OS_Budget.h"
+#include "OS_Overload.h"
+#include "OS_Partition.h"
+#include "OS_Load.h"
+#include "OS_Histogram.h"
+#include "OS_Latency.h"
+#include "OS_Profiler.h"
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -26,6 +40,35 @@
 /*-----------------------------------------------------------------------------------*/
 Task_t Global_TasksArr[NUM_OF_TASKS];
 
+#if NUM_OF_CREATED_TASKS > 0
+
+	static OS_TaskDescriptor_t Global_CreatedTasksArr[NUM_OF_CREATED_TASKS];	/* Global variable that holds descriptors of the tasks created at run time (free if pFunction is NULL) */
+
+#endif
+
+OS_Schedular_t Global_Schedular = {Global_TasksArr, NUM_OF_TASKS, OS_INSTANCE_PRIORITY, 0, 0, 0, 0, 0, 0, 0};	/* Global variable that holds the default schedular passed by SysTick */
+volatile uint32_t Global_DispatchLastCycles = 0;	/* Global variable that holds CPU cycles spent in the last tick pass */
+volatile uint32_t Global_DispatchMaxCycles = 0;		/* Global variable that holds CPU cycles spent in the longest tick pass */
+volatile uint8_t Global_RunningTask = OS_NO_TASK;	/* Global variable that holds priority of the task being executed */
+
+/* Linker script symbols bounding the task descriptors placed by DEFINE_TASK */
+extern const OS_TaskDescriptor_t _sos_tasks[];
+extern const OS_TaskDescriptor_t _eos_tasks[];
+
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint32_t OS_TakeDeferredActivations(OS_Schedular_t* Copy_pSchedular);
+static void OS_DispatchReadyTasks(OS_Schedular_t* Copy_pSchedular, uint32_t Copy_ReadyTasks);
+static uint8_t OS_PickTask(OS_Schedular_t* Copy_pSchedular, uint32_t Copy_ReadyTasks);
+static uint32_t OS_SchedularExecuteTask(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority);
+static void OS_TickPass(void);
+static void OS_TaskFreeDescriptor(const OS_TaskDescriptor_t* Copy_pDescriptor);
+static void OS_RegisterDefinedTasks(void);
+static void OS_SelfTimedSchedule(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority, uint32_t Copy_Delay);
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -49,11 +92,83 @@ Task_t Global_TasksArr[NUM_OF_TASKS];
 /*--------------------------------------------------------------------------------*/
 void OS_Init(void)
 {
+	/* Paint the free stack so that its peak usage can be reported */
+	OS_StackPaint();
+
+	/* Register tasks defined through DEFINE_TASK */
+	OS_RegisterDefinedTasks();
+
+	/* Enable the DWT cycle counter used to measure execution times, left running if traced code already started it */
+	if(GET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA) == 0)
+	{
+		SET_BIT(DEMCR, DEMCR_TRCENA);
+		DWT->CYCCNT = 0;
+		SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/*
+	 * Give SysTick (tick pass) and PendSV (event pass) the same lowest priority so that
+	 * task execution is never nested and every interrupt can preempt it
+	 */
+	SCB_SHPR3 = (SCB_SHPR3 & ~((SCB_SHPR3_PRI_MASK << SCB_SHPR3_PRI_PENDSV) | (SCB_SHPR3_PRI_MASK << SCB_SHPR3_PRI_SYSTICK))) |
+				(OS_KERNEL_INTERRUPT_PRIORITY << SCB_SHPR3_PRI_PENDSV) | (OS_KERNEL_INTERRUPT_PRIORITY << SCB_SHPR3_PRI_SYSTICK);
+
+	/* Check selected scheduling mode based on configuration file */
+	#if   OS_SCHEDULING_MODE == OS_PREEMPTIVE_SRP
+
+		/* Map every task to its IRQ and NVIC level */
+		OS_SrpInit();
+
+	#elif OS_SCHEDULING_MODE == OS_COOPERATIVE
+
+		/* Tasks run from the schedular passes, nothing to set up */
+
+	#else
+
+		#error " Wrong OS Scheduling Mode Configuration !"
+
+	#endif
+
+	#if OS_BUDGET_ENFORCEMENT == ENABLE
+
+		/* Start the timer watching task budgets */
+		OS_BudgetInit();
+
+	#endif
+
+	#if OS_PROFILER == ENABLE
+
+		/* Start sampling the program counter */
+		OS_ProfilerInit();
+
+	#endif
+
+	#if OS_PARTITIONING == ENABLE
+
+		/* Open the window of the first partition */
+		OS_PartitionInit();
+
+	#endif
+
 	/* Initialize STK */
 	STK_Init();
 
-	/* Set the schedular to be called every 1 sec */
-	STK_SetPeriodicInterval(1000000, SCHEDULAR);
+	/* Check selected dispatch based on configuration file */
+	#if   OS_CYCLIC_EXECUTIVE == ENABLE
+
+		/* Set the cyclic executive to be called every minor frame of the generated table */
+		STK_SetPeriodicInterval(OS_CYCLIC_MINOR_FRAME_US, OS_TickPass);
+
+	#else
+
+		/* Set the schedular to be called every OS tick (1 sec by default) */
+		STK_SetPeriodicInterval(OS_TICK_PERIOD, OS_TickPass);
+
+	#endif
 }
 
 
@@ -65,7 +180,8 @@ void OS_Init(void)
 /* 				   -------------------------------------------------------------- */
 /* 				   uint8_t Copy_Periodicity                                       */
 /* 				   Brief: Periodicity of the task to be created (How much time it */
-/*                        takes this task to be ready)                            */
+/*                        takes this task to be ready), 0 for a task that only    */
+/*                        runs when released through OS_ReleaseTask               */
 /*  			   -------------------------------------------------------------- */
 /* 				   void(*Copy_Fptr)(void)                                         */
 /* 				   Brief: Pointer to function of the task that will be executed   */
@@ -81,56 +197,1809 @@ void OS_Init(void)
 /*--------------------------------------------------------------------------------*/
 void TASKS_CREATION(uint8_t Copy_Priority,uint8_t Copy_Periodicity, void(*Copy_Fptr)(void))
 {
-	/* Assign the passed periodicity to the task based on its passed priority */
-	Global_TasksArr[Copy_Priority].TaskPeriodicity = Copy_Periodicity;
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
 
-	/*
-	 *  Register the task function to be called once the task is ready through
-	 *  assigning the passed pointer to that function to task based on its passed
-	 *  priority
-	 */
-	Global_TasksArr[Copy_Priority].PointerToFunction = Copy_Fptr;
+	#if NUM_OF_CREATED_TASKS > 0
+
+		uint8_t Local_DescriptorsCounter;		/* A variable to hold descriptor count */
+
+	#endif
+
+	/* Check if passed priority belongs to a task slot and passed function is valid or not */
+	if(Copy_Priority < NUM_OF_TASKS && Copy_Fptr != NULL)
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		#if OS_OVERLOAD_MANAGEMENT == ENABLE
 
+			/* A degraded task gives back its normal descriptor before the slot is reused */
+			OS_OverloadTaskReset(Copy_Priority);
+
+		#endif
+
+		/* A task created again at its priority gives back its descriptor first */
+		OS_TaskFreeDescriptor(Global_TasksArr[Copy_Priority].pDescriptor);
+
+		/* No task is created without descriptors left in RAM (NUM_OF_CREATED_TASKS) */
+		#if NUM_OF_CREATED_TASKS > 0
+
+			for(Local_DescriptorsCounter = 0 ; Local_DescriptorsCounter < NUM_OF_CREATED_TASKS ; Local_DescriptorsCounter++)
+			{
+				if(Global_CreatedTasksArr[Local_DescriptorsCounter].pFunction == NULL)
+				{
+					/* Register the task with no offset (first release at tick == periodicity) */
+					Global_CreatedTasksArr[Local_DescriptorsCounter].pFunction = Copy_Fptr;
+					Global_CreatedTasksArr[Local_DescriptorsCounter].Priority = Copy_Priority;
+					Global_CreatedTasksArr[Local_DescriptorsCounter].Periodicity = Copy_Periodicity;
+					Global_CreatedTasksArr[Local_DescriptorsCounter].Offset = 0;
+					(void)OS_SchedularTaskRegister(&Global_Schedular, &Global_CreatedTasksArr[Local_DescriptorsCounter]);
+					break;
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+			}
+
+		#endif
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
 }
 
 /*--------------------------------------------------------------------------------*/
-/* @Function Name: SCHEDULAR          					                          */
+/* @Function Name: OS_TaskCreateSelfTimed                                         */
 /*--------------------------------------------------------------------------------*/
-/* @Param(in)	 : None				                                              */
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be created                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t(*Copy_Fptr)(void)                                     */
+/*                 Brief: Task function, returns the OS ticks until its next      */
+/*                        release (0 is taken as 1) or OS_WAIT_FOR_EVENT          */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_FirstDelay                                       */
+/*                 Brief: OS ticks until the first release or OS_WAIT_FOR_EVENT   */
+/*                 Range: (0 --> OS_MAX_SELF_TIMED_DELAY), longer ones are cut    */
 /*--------------------------------------------------------------------------------*/
-/* @Param(inout) : None                                                	          */
+/* @Param(inout) : None                                                           */
 /*--------------------------------------------------------------------------------*/
-/* @Param(out)	 : None                                            	              */
+/* @Param(out)   : None                                                           */
 /*--------------------------------------------------------------------------------*/
-/* @Return		 : void                                          				  */
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task with a variable period: each run sets the time  */
+/*                 of its next release, so every dispatch does real work (it can  */
+/*                 still be released on demand or by events at any time)          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskCreateSelfTimed(uint8_t Copy_Priority, uint32_t (*Copy_Fptr)(void), uint32_t Copy_FirstDelay)
+{
+	return OS_SchedularTaskCreateSelfTimed(&Global_Schedular, Copy_Priority, Copy_Fptr, Copy_FirstDelay);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ReleaseTask                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be released                     */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Releases a task once on the next schedular pass regardless of  */
+/*                 its periodicity, safe to be called from tasks and ISRs         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ReleaseTask(uint8_t Copy_Priority)
+{
+	return OS_SchedularReleaseTask(&Global_Schedular, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskActivate                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be activated by an event        */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : Scheduler to manage tasks according to periodicity and         */
-/* 				   priority        												  */
+/* @Return       : ERROR_STATUS_t (BUSY_FUNC if the event came before minimum     */
+/*                 inter-arrival time of the task and was deferred)               */
 /*--------------------------------------------------------------------------------*/
-void SCHEDULAR(void)
+/* @Description  : Activates a task on an event (interrupt, queue, flag) without  */
+/*                 waiting for the next tick, the task is run by an event pass    */
+/*                 (PendSV) in priority order with other ready tasks. Events      */
+/*                 closer than the minimum inter-arrival time of the task are     */
+/*                 merged into one activation served by the first tick or event   */
+/*                 pass after that time elapsed (rounded up to the next tick if   */
+/*                 no other event comes)                                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskActivate(uint8_t Copy_Priority)
 {
 	/* Local Variables Definitions */
-	static uint32_t Local_SystemTickCounter = 0; /* A variable to hold system tick counts */
-	uint8_t Local_TasksCounter;					 /* A variable to hold task count */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+	uint32_t Local_CycleCount;					/* A variable to hold cycle count at event arrival */
 
-	/* Increment System Tick Counter */
-	Local_SystemTickCounter++;
+	/* Check if passed priority belongs to an active task or not */
+	if(Copy_Priority < NUM_OF_TASKS && GET_BIT(Global_Schedular.ActiveMask, Copy_Priority))
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
 
-	/*
-	 * Traverse over tasks in the system to see which on is ready to be executed
-	 * according to periodicity and prority
-	 */
-	for(Local_TasksCounter = 0 ; Local_TasksCounter < NUM_OF_TASKS ; Local_TasksCounter++)
+		Local_CycleCount = OS_CYCLE_COUNT();
+
+		/* Accept the event only if no event is already deferred and the minimum inter-arrival time elapsed */
+		if(GET_BIT(Global_Schedular.DeferredMask, Copy_Priority) == 0 &&
+		   (Local_CycleCount - Global_TasksArr[Copy_Priority].LastActivation) >= Global_TasksArr[Copy_Priority].MinInterArrival)
+		{
+			Global_TasksArr[Copy_Priority].LastActivation = Local_CycleCount;
+			Global_Schedular.ReleaseMask |= (1UL << Copy_Priority);
+
+			#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+				/* The task is due from the event on */
+				OS_HistogramStampEvent(Copy_Priority, Local_CycleCount);
+
+			#endif
+
+			/* Run an event pass as soon as no higher priority handler is active */
+			OS_PEND_DISPATCH();
+		}
+		else
+		{
+			/* Event storm, merge this event into one deferred activation */
+			Global_Schedular.DeferredMask |= (1UL << Copy_Priority);
+			Local_Status = BUSY_FUNC;
+		}
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetMinInterArrival                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_MinInterArrivalUs                                */
+/*                 Brief: Minimum time between two event activations in us, 0 for */
+/*                        no limit                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the minimum inter-arrival time protecting the CPU from    */
+/*                 event storms on an event activated task                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetMinInterArrival(uint8_t Copy_Priority, uint32_t Copy_MinInterArrivalUs)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	/* Check if passed priority belongs to a task in the system and passed time fits the cycle counter or not */
+	if(Copy_Priority < NUM_OF_TASKS && Copy_MinInterArrivalUs <= (0xFFFFFFFFUL / (OS_CPU_CLOCK_HZ / 1000000UL)))
+	{
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		Global_TasksArr[Copy_Priority].MinInterArrival = OS_US_TO_CYCLES(Copy_MinInterArrivalUs);
+
+		/* Let the very next event be accepted */
+		Global_TasksArr[Copy_Priority].LastActivation = OS_CYCLE_COUNT() - Global_TasksArr[Copy_Priority].MinInterArrival;
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSuspend                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be suspended                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stops releasing a task (periodically and on demand) until it   */
+/*                 is resumed, a suspended task costs nothing in the tick path    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSuspend(uint8_t Copy_Priority)
+{
+	return OS_SchedularTaskSuspend(&Global_Schedular, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskResume                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be resumed                      */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes a suspended task, its next release is the next one on  */
+/*                 its original release grid so its phase is kept                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskResume(uint8_t Copy_Priority)
+{
+	return OS_SchedularTaskResume(&Global_Schedular, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskChangePeriod                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: New periodicity of the task in OS ticks, 0 for a task   */
+/*                        that only runs when released through OS_ReleaseTask     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Changes the periodicity of a task, the already planned next    */
+/*                 release is kept and the new periodicity is counted from it     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskChangePeriod(uint8_t Copy_Priority, uint8_t Copy_Periodicity)
+{
+	return OS_SchedularTaskChangePeriod(&Global_Schedular, Copy_Priority, Copy_Periodicity);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskDelete                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be deleted                      */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Removes a task from the system and frees its priority slot     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskDelete(uint8_t Copy_Priority)
+{
+	return OS_SchedularTaskDelete(&Global_Schedular, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskGetState                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint8_t* Copy_pState                                           */
+/*                 Brief: State of the task (OS_TASK_xxx)                         */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the current state of a task                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskGetState(uint8_t Copy_Priority, uint8_t* Copy_pState)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pState != NULL)
+	{
+		/* Check if passed priority belongs to a task in the system or not */
+		if(Copy_Priority < NUM_OF_TASKS)
+		{
+			*Copy_pState = Global_TasksArr[Copy_Priority].TaskState;
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskSetSuccessors                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the predecessor task                        */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_SuccessorsMask                                   */
+/*                 Brief: One bit per task to be released once the predecessor    */
+/*                        completes (bit number = task priority), 0 for none      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the tasks released in the same schedular pass right after */
+/*                 a task completes, whatever their priorities (RT_NOK if they    */
+/*                 lead back to the task)                                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TaskSetSuccessors(uint8_t Copy_Priority, uint32_t Copy_SuccessorsMask)
+{
+	return OS_SchedularTaskSetSuccessors(&Global_Schedular, Copy_Priority, Copy_SuccessorsMask);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_GetRunningTask                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns priority of the task being executed, or OS_NO_TASK     */
+/*                 when called outside of a task                                  */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_GetRunningTask(void)
+{
+	return Global_RunningTask;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_GetTickCount                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns the number of OS ticks (schedular passes) since the    */
+/*                 OS was started                                                 */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_GetTickCount(void)
+{
+	return Global_Schedular.TickCounter;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_GetCycleCount                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns the free running CPU cycle counter, differences of two */
+/*                 readings give cycle accurate durations (wraps every 2^32       */
+/*                 cycles)                                                        */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_GetCycleCount(void)
+{
+	return OS_CYCLE_COUNT();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_GetDispatchCycles                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pLastCycles                                     */
+/*                 Brief: CPU cycles spent in the last tick pass                  */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pMaxCycles                                      */
+/*                 Brief: CPU cycles spent in the longest tick pass (may be NULL) */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the cost of the tick pass including the tasks it ran, to  */
+/*                 compare the static and the table driven schedular              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_GetDispatchCycles(uint32_t* Copy_pLastCycles, uint32_t* Copy_pMaxCycles)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pLastCycles != NULL)
 	{
-		/* Check if current task is ready or not */
-		if((Local_SystemTickCounter % Global_TasksArr[Local_TasksCounter].TaskPeriodicity) == 0)
+		*Copy_pLastCycles = Global_DispatchLastCycles;
+
+		if(Copy_pMaxCycles != NULL)
 		{
-			/* Execute the task function */
-			Global_TasksArr[Local_TasksCounter].PointerToFunction();
+			*Copy_pMaxCycles = Global_DispatchMaxCycles;
 		}
 		else
 		{
 			/* Do Nothing */
 		}
 	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ExecuteTask                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be executed                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t (successors released by the task)                     */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs a task if it is still active, used by the dispatcher and  */
+/*                 the OS_PREEMPTIVE_SRP task handlers (not for application use)  */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_ExecuteTask(uint8_t Copy_Priority)
+{
+	return OS_SchedularExecuteTask(&Global_Schedular, Copy_Priority);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SCHEDULAR                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular whose clock source ticked                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Scheduler to manage tasks according to periodicity and         */
+/*                 priority: counts the tick, releases the due periodic and       */
+/*                 self-timed tasks and dispatches them with the pending on       */
+/*                 demand releases (the default schedular is passed by SysTick)   */
+/*--------------------------------------------------------------------------------*/
+void SCHEDULAR(OS_Schedular_t* Copy_pSchedular)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_TickCounter;				 /* A variable to hold tick count of the schedular */
+	uint8_t Local_TasksCounter;					 /* A variable to hold task count */
+	uint32_t Local_ReadyTasks = 0;				 /* A variable to hold tasks released periodically in this pass */
+	uint32_t Local_PeriodicTasks;				 /* A variable to hold periodic tasks still to be checked */
+	uint32_t Local_InterruptsState;				 /* A variable to hold interrupts state before the critical section */
+
+	/* Preempting tasks may change periods and releases, take the periodic releases at once */
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	/* Increment the tick counter of the schedular */
+	Local_TickCounter = ++Copy_pSchedular->TickCounter;
+
+	/*
+	 * Check only active periodic tasks for their release, suspended tasks and tasks
+	 * with zero periodicity are not part of the mask so they cost nothing here
+	 */
+	Local_PeriodicTasks = Copy_pSchedular->PeriodicMask;
+
+	while(Local_PeriodicTasks != 0)
+	{
+		Local_TasksCounter = (uint8_t)__builtin_ctzl(Local_PeriodicTasks);
+		CLEAR_BIT(Local_PeriodicTasks, Local_TasksCounter);
+
+		if(Local_TickCounter == Copy_pSchedular->pTasksArr[Local_TasksCounter].NextRelease)
+		{
+			/* Plan the next release with the current periodicity, so a period change applies from here */
+			Copy_pSchedular->pTasksArr[Local_TasksCounter].NextRelease += Copy_pSchedular->pTasksArr[Local_TasksCounter].TaskPeriodicity;
+			SET_BIT(Local_ReadyTasks, Local_TasksCounter);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	/* Self-timed tasks are released once the delay they returned is over (late if they were suspended meanwhile) */
+	Local_PeriodicTasks = Copy_pSchedular->SelfTimedWaitingMask & Copy_pSchedular->ActiveMask;
+
+	while(Local_PeriodicTasks != 0)
+	{
+		Local_TasksCounter = (uint8_t)__builtin_ctzl(Local_PeriodicTasks);
+		CLEAR_BIT(Local_PeriodicTasks, Local_TasksCounter);
+
+		if((sint32_t)(Local_TickCounter - Copy_pSchedular->pTasksArr[Local_TasksCounter].NextRelease) >= 0)
+		{
+			/* Released once, the next release is set by its next run */
+			CLEAR_BIT(Copy_pSchedular->SelfTimedWaitingMask, Local_TasksCounter);
+			SET_BIT(Local_ReadyTasks, Local_TasksCounter);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+
+	/* Run periodic releases together with pending on demand and event releases */
+	OS_DispatchReadyTasks(Copy_pSchedular, Local_ReadyTasks);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskRegister                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_TaskDescriptor_t* Copy_pDescriptor                    */
+/*                 Brief: Descriptor of the task to be created, kept referenced   */
+/*                        by the task table                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Fills the runtime state of a task and makes it active,         */
+/*                 first released one period plus offset from now                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskRegister(OS_Schedular_t* Copy_pSchedular, const OS_TaskDescriptor_t* Copy_pDescriptor)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+	uint8_t Local_Priority;						/* A variable to hold priority of the task */
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pSchedular != NULL && Copy_pDescriptor != NULL)
+	{
+		Local_Priority = Copy_pDescriptor->Priority;
+
+		/* Check if the descriptor priority belongs to a task slot and its function is valid or not */
+		if(Local_Priority < Copy_pSchedular->NumOfTasks && Copy_pDescriptor->pFunction != NULL)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+
+			#if OS_OVERLOAD_MANAGEMENT == ENABLE
+
+				/* A degraded task gives back its normal descriptor before the slot is reused */
+				if(Copy_pSchedular == &Global_Schedular)
+				{
+					OS_OverloadTaskReset(Local_Priority);
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+
+			#endif
+
+			/* The periodicity starts from the descriptor one and may be changed at run time */
+			Copy_pSchedular->pTasksArr[Local_Priority].TaskPeriodicity = Copy_pDescriptor->Periodicity;
+
+			/*
+			 *  Register the task function to be called once the task is ready through
+			 *  referencing the descriptor holding it, which stays in flash for DEFINE_TASK tasks
+			 */
+			Copy_pSchedular->pTasksArr[Local_Priority].pDescriptor = Copy_pDescriptor;
+			Copy_pSchedular->pTasksArr[Local_Priority].PointerToSelfTimedFunction = NULL;
+			Copy_pSchedular->SelfTimedWaitingMask &= ~(1UL << Local_Priority);
+
+			/* First release is one period plus offset from now (at tick == offset + periodicity for tasks created before OS_Init) */
+			Copy_pSchedular->pTasksArr[Local_Priority].NextRelease = Copy_pSchedular->TickCounter + Copy_pDescriptor->Offset + Copy_pDescriptor->Periodicity;
+			Copy_pSchedular->pTasksArr[Local_Priority].TaskState = OS_TASK_ACTIVE;
+
+			Copy_pSchedular->ActiveMask |= (1UL << Local_Priority);
+
+			if(Copy_pDescriptor->Periodicity != 0)
+			{
+				Copy_pSchedular->PeriodicMask |= (1UL << Local_Priority);
+			}
+			else
+			{
+				Copy_pSchedular->PeriodicMask &= ~(1UL << Local_Priority);
+			}
+
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskCreateSelfTimed                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be created                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t(*Copy_Fptr)(void)                                     */
+/*                 Brief: Task function, returns the ticks until its next         */
+/*                        release (0 is taken as 1) or OS_WAIT_FOR_EVENT          */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_FirstDelay                                       */
+/*                 Brief: Ticks until the first release or OS_WAIT_FOR_EVENT      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a task with a variable period, each run sets the       */
+/*                 time of its next release                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskCreateSelfTimed(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority, uint32_t (*Copy_Fptr)(void), uint32_t Copy_FirstDelay)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSchedular != NULL)
+	{
+		/* Check if passed priority belongs to a task slot and passed function is valid or not */
+		if(Copy_Priority < Copy_pSchedular->NumOfTasks && Copy_Fptr != NULL)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+
+			#if OS_OVERLOAD_MANAGEMENT == ENABLE
+
+				/* A degraded task gives back its normal descriptor before the slot is reused */
+				if(Copy_pSchedular == &Global_Schedular)
+				{
+					OS_OverloadTaskReset(Copy_Priority);
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+
+			#endif
+
+			/* No periodic release, the task itself tells when it is released next */
+			OS_TaskFreeDescriptor(Copy_pSchedular->pTasksArr[Copy_Priority].pDescriptor);
+			Copy_pSchedular->pTasksArr[Copy_Priority].TaskPeriodicity = 0;
+			Copy_pSchedular->pTasksArr[Copy_Priority].pDescriptor = NULL;
+			Copy_pSchedular->pTasksArr[Copy_Priority].PointerToSelfTimedFunction = Copy_Fptr;
+			Copy_pSchedular->pTasksArr[Copy_Priority].TaskState = OS_TASK_ACTIVE;
+
+			Copy_pSchedular->ActiveMask |= (1UL << Copy_Priority);
+			Copy_pSchedular->PeriodicMask &= ~(1UL << Copy_Priority);
+
+			OS_SelfTimedSchedule(Copy_pSchedular, Copy_Priority, Copy_FirstDelay);
+
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularReleaseTask                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be released                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Releases a task once on the next pass of its schedular,        */
+/*                 safe to be called from tasks and ISRs                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularReleaseTask(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSchedular != NULL)
+	{
+		/* Check if passed priority belongs to a task of the schedular or not */
+		if(Copy_Priority < Copy_pSchedular->NumOfTasks)
+		{
+			/* Mark the task as released, several releases before the next pass count as one */
+			OS_ATOMIC_SET_BITS(&Copy_pSchedular->ReleaseMask, (1UL << Copy_Priority));
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskSuspend                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be suspended                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stops releasing a task (periodically and on demand) until      */
+/*                 it is resumed                                                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskSuspend(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSchedular != NULL)
+	{
+		/* Check if passed priority belongs to a task of the schedular or not */
+		if(Copy_Priority < Copy_pSchedular->NumOfTasks)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+
+			if(Copy_pSchedular->pTasksArr[Copy_Priority].TaskState == OS_TASK_ACTIVE)
+			{
+				/* Take the task out of the tick path, its next release is kept to restore its phase on resume */
+				Copy_pSchedular->ActiveMask &= ~(1UL << Copy_Priority);
+				Copy_pSchedular->PeriodicMask &= ~(1UL << Copy_Priority);
+				Copy_pSchedular->DeferredMask &= ~(1UL << Copy_Priority);
+				Copy_pSchedular->pTasksArr[Copy_Priority].TaskState = OS_TASK_SUSPENDED;
+			}
+			else
+			{
+				/* Task is deleted or already suspended */
+				Local_Status = RT_NOK;
+			}
+
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskResume                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be resumed                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes a suspended task on its original release grid          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskResume(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+	uint32_t Local_MissedTicks;					/* A variable to hold ticks elapsed since the missed release */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSchedular != NULL)
+	{
+		/* Check if passed priority belongs to a task of the schedular or not */
+		if(Copy_Priority < Copy_pSchedular->NumOfTasks)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+
+			if(Copy_pSchedular->pTasksArr[Copy_Priority].TaskState == OS_TASK_SUSPENDED)
+			{
+				if(Copy_pSchedular->pTasksArr[Copy_Priority].TaskPeriodicity != 0)
+				{
+					/* Skip the releases missed while suspended, the first one not yet due is on the original grid */
+					Local_MissedTicks = Copy_pSchedular->TickCounter - Copy_pSchedular->pTasksArr[Copy_Priority].NextRelease;
+
+					if((sint32_t)Local_MissedTicks >= 0)
+					{
+						Copy_pSchedular->pTasksArr[Copy_Priority].NextRelease += ((Local_MissedTicks / Copy_pSchedular->pTasksArr[Copy_Priority].TaskPeriodicity) + 1) *
+																	  Copy_pSchedular->pTasksArr[Copy_Priority].TaskPeriodicity;
+					}
+					else
+					{
+						/* Do Nothing */
+					}
+
+					Copy_pSchedular->PeriodicMask |= (1UL << Copy_Priority);
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+
+				Copy_pSchedular->ActiveMask |= (1UL << Copy_Priority);
+				Copy_pSchedular->pTasksArr[Copy_Priority].TaskState = OS_TASK_ACTIVE;
+			}
+			else
+			{
+				/* Task is deleted or not suspended */
+				Local_Status = RT_NOK;
+			}
+
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskChangePeriod                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Periodicity                                       */
+/*                 Brief: New periodicity of the task in ticks, 0 for a task      */
+/*                        that only runs when released on demand                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Changes the periodicity of a task from its already planned     */
+/*                 next release                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskChangePeriod(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority, uint8_t Copy_Periodicity)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSchedular != NULL)
+	{
+		/* Check if passed priority belongs to a task of the schedular or not */
+		if(Copy_Priority < Copy_pSchedular->NumOfTasks)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+
+			if(Copy_pSchedular->pTasksArr[Copy_Priority].TaskState != OS_TASK_DELETED && Copy_pSchedular->pTasksArr[Copy_Priority].PointerToSelfTimedFunction == NULL)
+			{
+				/* A task that had no periodic release starts its grid one new period from now */
+				if(Copy_pSchedular->pTasksArr[Copy_Priority].TaskPeriodicity == 0)
+				{
+					Copy_pSchedular->pTasksArr[Copy_Priority].NextRelease = Copy_pSchedular->TickCounter + Copy_Periodicity;
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+
+				Copy_pSchedular->pTasksArr[Copy_Priority].TaskPeriodicity = Copy_Periodicity;
+
+				/* Only active tasks with non zero periodicity are checked on each tick */
+				if(Copy_Periodicity != 0 && Copy_pSchedular->pTasksArr[Copy_Priority].TaskState == OS_TASK_ACTIVE)
+				{
+					Copy_pSchedular->PeriodicMask |= (1UL << Copy_Priority);
+				}
+				else
+				{
+					Copy_pSchedular->PeriodicMask &= ~(1UL << Copy_Priority);
+				}
+			}
+			else
+			{
+				/* Task is deleted or self-timed */
+				Local_Status = RT_NOK;
+			}
+
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskDelete                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be deleted                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Removes a task from its schedular and frees its slot           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskDelete(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSchedular != NULL)
+	{
+		/* Check if passed priority belongs to a task of the schedular or not */
+		if(Copy_Priority < Copy_pSchedular->NumOfTasks)
+		{
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+
+			if(Copy_pSchedular->pTasksArr[Copy_Priority].TaskState != OS_TASK_DELETED)
+			{
+				Copy_pSchedular->ActiveMask &= ~(1UL << Copy_Priority);
+				Copy_pSchedular->PeriodicMask &= ~(1UL << Copy_Priority);
+				Copy_pSchedular->DeferredMask &= ~(1UL << Copy_Priority);
+				Copy_pSchedular->SelfTimedWaitingMask &= ~(1UL << Copy_Priority);
+				Copy_pSchedular->pTasksArr[Copy_Priority].TaskState = OS_TASK_DELETED;
+
+				#if OS_OVERLOAD_MANAGEMENT == ENABLE
+
+					/* A degraded task gives back its normal descriptor so the right one is freed */
+					if(Copy_pSchedular == &Global_Schedular)
+					{
+						OS_OverloadTaskReset(Copy_Priority);
+					}
+					else
+					{
+						/* Do Nothing */
+					}
+
+				#endif
+
+				OS_TaskFreeDescriptor(Copy_pSchedular->pTasksArr[Copy_Priority].pDescriptor);
+				Copy_pSchedular->pTasksArr[Copy_Priority].TaskPeriodicity = 0;
+				Copy_pSchedular->pTasksArr[Copy_Priority].pDescriptor = NULL;
+				Copy_pSchedular->pTasksArr[Copy_Priority].PointerToSelfTimedFunction = NULL;
+			}
+			else
+			{
+				/* Task is already deleted */
+				Local_Status = RT_NOK;
+			}
+
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularTaskSetSuccessors                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the predecessor task                        */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_SuccessorsMask                                   */
+/*                 Brief: One bit per task to be released once the predecessor    */
+/*                        completes (bit number = task priority), 0 for none      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the tasks released in the same pass right after a         */
+/*                 task completes, successors leading back to the task (cycles)   */
+/*                 are rejected                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SchedularTaskSetSuccessors(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority, uint32_t Copy_SuccessorsMask)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+	uint32_t Local_ReachedTasks;				/* A variable to hold tasks released, directly or not, by the new successors */
+	uint32_t Local_PreviousReached;				/* A variable to hold reached tasks before the last walk step */
+	uint32_t Local_StepTasks;					/* A variable to hold reached tasks still to be walked in this step */
+	uint8_t Local_TasksCounter;					/* A variable to hold task count */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSchedular != NULL)
+	{
+		/* Check if passed priority and successors belong to tasks of the schedular or not */
+		if(Copy_Priority < Copy_pSchedular->NumOfTasks && (Copy_SuccessorsMask & ~(0xFFFFFFFFUL >> (32U - Copy_pSchedular->NumOfTasks))) == 0)
+		{
+			/* Another context setting successors meanwhile could close a cycle behind the walk */
+			OS_ENTER_CRITICAL(Local_InterruptsState);
+
+			/* Walk the successor graph from the new successors until no new task is reached */
+			Local_ReachedTasks = Copy_SuccessorsMask;
+
+			do
+			{
+				Local_PreviousReached = Local_ReachedTasks;
+				Local_StepTasks = Local_ReachedTasks & ~(1UL << Copy_Priority);
+
+				while(Local_StepTasks != 0)
+				{
+					Local_TasksCounter = (uint8_t)__builtin_ctzl(Local_StepTasks);
+					CLEAR_BIT(Local_StepTasks, Local_TasksCounter);
+					Local_ReachedTasks |= Copy_pSchedular->pTasksArr[Local_TasksCounter].SuccessorsMask;
+				}
+			}while(Local_ReachedTasks != Local_PreviousReached);
+
+			/* A chain leading back to the predecessor would keep the dispatcher running it forever */
+			if(GET_BIT(Local_ReachedTasks, Copy_Priority) == 0)
+			{
+				Copy_pSchedular->pTasksArr[Copy_Priority].SuccessorsMask = Copy_SuccessorsMask;
+			}
+			else
+			{
+				/* Successors close a cycle */
+				Local_Status = RT_NOK;
+			}
+
+			OS_EXIT_CRITICAL(Local_InterruptsState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                         PRIVATE FUNCTIONS IMPLEMENTATIONS                         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TakeDeferredActivations                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular being dispatched                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t (one bit per task released)                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Releases deferred event activations whose minimum              */
+/*                 inter-arrival time elapsed                                     */
+/*--------------------------------------------------------------------------------*/
+static uint32_t OS_TakeDeferredActivations(OS_Schedular_t* Copy_pSchedular)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_ReleasedTasks = 0;			/* A variable to hold deferred tasks released now */
+	uint32_t Local_DeferredTasks;				/* A variable to hold deferred tasks still to be checked */
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+	uint32_t Local_CycleCount;					/* A variable to hold current cycle count */
+	uint8_t Local_TasksCounter;					/* A variable to hold task count */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	Local_CycleCount = OS_CYCLE_COUNT();
+	Local_DeferredTasks = Copy_pSchedular->DeferredMask;
+
+	while(Local_DeferredTasks != 0)
+	{
+		Local_TasksCounter = (uint8_t)__builtin_ctzl(Local_DeferredTasks);
+		CLEAR_BIT(Local_DeferredTasks, Local_TasksCounter);
+
+		if((Local_CycleCount - Copy_pSchedular->pTasksArr[Local_TasksCounter].LastActivation) >= Copy_pSchedular->pTasksArr[Local_TasksCounter].MinInterArrival)
+		{
+			Copy_pSchedular->pTasksArr[Local_TasksCounter].LastActivation = Local_CycleCount;
+			Local_ReleasedTasks |= (1UL << Local_TasksCounter);
+
+			#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+				/* The task is due from this pass on, the wait for a pass is the deferral itself (histograms are kept for the default schedular) */
+				if(Copy_pSchedular == &Global_Schedular)
+				{
+					OS_HistogramStampEvent(Local_TasksCounter, Local_CycleCount);
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+
+			#endif
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+
+	Copy_pSchedular->DeferredMask &= ~Local_ReleasedTasks;
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+
+	return Local_ReleasedTasks;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_DispatchReadyTasks                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_ReadyTasks                                       */
+/*                 Brief: Tasks released periodically in this pass                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular being dispatched                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Dispatcher shared by tick and event passes, runs the passed    */
+/*                 tasks with all pending on demand and event releases in the     */
+/*                 order of the schedular policy, then the successors they        */
+/*                 release (the scheduling mode applies to the default schedular, */
+/*                 other schedulars run their tasks to completion)                */
+/*--------------------------------------------------------------------------------*/
+static void OS_DispatchReadyTasks(OS_Schedular_t* Copy_pSchedular, uint32_t Copy_ReadyTasks)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_TasksCounter;					 /* A variable to hold task count */
+
+	/* Take all on demand releases at once so that none raised during this pass is lost */
+	Copy_ReadyTasks |= OS_ATOMIC_EXCHANGE(&Copy_pSchedular->ReleaseMask, 0);
+
+	/* Take deferred events whose minimum inter-arrival time elapsed */
+	if(Copy_pSchedular->DeferredMask != 0)
+	{
+		Copy_ReadyTasks |= OS_TakeDeferredActivations(Copy_pSchedular);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+		/* Set the nominal release of every release of this pass, dropped ones included */
+		if(Copy_pSchedular == &Global_Schedular)
+		{
+			OS_HistogramStampPass(Copy_ReadyTasks);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+	#endif
+
+	/* Releases of suspended or deleted tasks are dropped */
+	Copy_ReadyTasks &= Copy_pSchedular->ActiveMask;
+
+	/* Check selected scheduling mode based on configuration file */
+	#if   OS_SCHEDULING_MODE == OS_PREEMPTIVE_SRP
+
+		if(Copy_pSchedular == &Global_Schedular)
+		{
+			#if OS_INTERRUPT_LATENCY == ENABLE
+
+				/* Tasks of a tick pass start after SysTick_Handler returns, the first one takes the dispatch latency */
+				OS_LatencyTasksPended(Copy_ReadyTasks);
+
+			#endif
+
+			/* Let the NVIC run ready tasks according to priority, preempting lower priority ones */
+			OS_SrpPendTasks(Copy_ReadyTasks);
+			Copy_ReadyTasks = 0;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+	#elif OS_SCHEDULING_MODE == OS_COOPERATIVE && OS_PARTITIONING == ENABLE
+
+		if(Copy_pSchedular == &Global_Schedular)
+		{
+			/* Only the partition owning the current window runs, other releases wait for their window */
+			OS_PartitionDispatch(Copy_ReadyTasks);
+			Copy_ReadyTasks = 0;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+	#elif OS_SCHEDULING_MODE != OS_COOPERATIVE
+
+		#error " Wrong OS Scheduling Mode Configuration !"
+
+	#endif
+
+	/* Execute ready tasks according to the schedular policy, to completion in the context of the pass */
+	while(Copy_ReadyTasks != 0)
+	{
+		Local_TasksCounter = OS_PickTask(Copy_pSchedular, Copy_ReadyTasks);
+		CLEAR_BIT(Copy_ReadyTasks, Local_TasksCounter);
+
+		/* Successors of the completed task run in this same pass (chains) */
+		Copy_ReadyTasks |= OS_SchedularExecuteTask(Copy_pSchedular, Local_TasksCounter);
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_PickTask                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_ReadyTasks                                       */
+/*                 Brief: Ready tasks of the schedular (not 0)                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular being dispatched                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t                                                        */
+/*                 Brief: Priority of the next task to be run                     */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Picks the next task to be run according to the schedular      */
+/*                 policy                                                         */
+/*--------------------------------------------------------------------------------*/
+static uint8_t OS_PickTask(OS_Schedular_t* Copy_pSchedular, uint32_t Copy_ReadyTasks)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_TaskPriority;					/* A variable to hold priority of the picked task */
+	uint32_t Local_NextTasks;					/* A variable to hold ready tasks at or after the round robin position */
+
+	if(Copy_pSchedular->Policy == OS_INSTANCE_ROUND_ROBIN)
+	{
+		/* First ready task from the round robin position, wrapping to the highest priority one */
+		Local_NextTasks = Copy_ReadyTasks & ~((1UL << Copy_pSchedular->RoundRobinNext) - 1UL);
+		Local_TaskPriority = (uint8_t)__builtin_ctzl((Local_NextTasks != 0) ? Local_NextTasks : Copy_ReadyTasks);
+
+		Copy_pSchedular->RoundRobinNext = (Local_TaskPriority + 1U >= Copy_pSchedular->NumOfTasks) ? 0U : (uint8_t)(Local_TaskPriority + 1U);
+	}
+	else
+	{
+		/* Highest priority ready task (lowest bit number) */
+		Local_TaskPriority = (uint8_t)__builtin_ctzl(Copy_ReadyTasks);
+	}
+
+	return Local_TaskPriority;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SchedularExecuteTask                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task to be executed                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t (successors released by the task)                     */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Runs a task if it is still active, accounting and budgets     */
+/*                 only apply to tasks of the default schedular                   */
+/*--------------------------------------------------------------------------------*/
+static uint32_t OS_SchedularExecuteTask(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_Successors = 0;				 /* A variable to hold successors released by the task */
+	void (*Local_pTaskFunction)(void);			 /* A variable to hold function of the task being executed */
+	uint32_t (*Local_pSelfTimedFunction)(void);	 /* A variable to hold function of the task if it is self-timed */
+	uint8_t Local_PreviousTask = OS_NO_TASK;	 /* A variable to hold the task interrupted by this one (if any) */
+	uint8_t Local_IsDefault;					 /* A variable to hold whether the task belongs to the default schedular */
+#if OS_BUDGET_ENFORCEMENT == ENABLE
+	uint16_t Local_BudgetStart = 0;				 /* A variable to hold budget timer count at dispatch */
+#endif
+#if OS_LOAD_ACCOUNTING == ENABLE
+	OS_LoadTaskState_t Local_LoadState;			 /* A variable to hold load accounting state of the task */
+#endif
+#if OS_LATENCY_HISTOGRAMS == ENABLE
+	OS_HistogramTaskState_t Local_HistogramState; /* A variable to hold release and start time of the run */
+#endif
+
+	/* A task suspended or deleted after being made ready is skipped */
+	if(Copy_Priority < Copy_pSchedular->NumOfTasks)
+	{
+		Local_pTaskFunction = (Copy_pSchedular->pTasksArr[Copy_Priority].pDescriptor != NULL) ? Copy_pSchedular->pTasksArr[Copy_Priority].pDescriptor->pFunction : NULL;
+		Local_pSelfTimedFunction = Copy_pSchedular->pTasksArr[Copy_Priority].PointerToSelfTimedFunction;
+
+		if(GET_BIT(Copy_pSchedular->ActiveMask, Copy_Priority) && (Local_pTaskFunction != NULL || Local_pSelfTimedFunction != NULL))
+		{
+			/* Running task and accounting are kept for the default schedular, whose priorities they are indexed by */
+			Local_IsDefault = (Copy_pSchedular == &Global_Schedular);
+
+			if(Local_IsDefault)
+			{
+				/* Execute the task function, tasks nest when preempting each other */
+				Local_PreviousTask = Global_RunningTask;
+				Global_RunningTask = Copy_Priority;
+
+				#if OS_INTERRUPT_LATENCY == ENABLE
+
+					/* Dispatch latency ends here for the first task of a tick */
+					OS_LatencyTaskStart();
+
+				#endif
+
+				#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+					/* Release jitter ends here */
+					OS_HistogramTaskStart(Copy_Priority, &Local_HistogramState);
+
+				#endif
+
+				#if OS_LOAD_ACCOUNTING == ENABLE
+
+					/* Count the cycles spent in the task toward its share */
+					OS_LoadTaskStart(&Local_LoadState);
+
+				#endif
+
+				#if OS_BUDGET_ENFORCEMENT == ENABLE
+
+					/* Watch the task for its CPU budget while it runs */
+					Local_BudgetStart = OS_BudgetStart(Copy_Priority);
+
+				#endif
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+
+			if(Local_pSelfTimedFunction != NULL)
+			{
+				/* A self-timed task returns when it is to be released next */
+				OS_SelfTimedSchedule(Copy_pSchedular, Copy_Priority, Local_pSelfTimedFunction());
+			}
+			else
+			{
+				Local_pTaskFunction();
+			}
+
+			if(Local_IsDefault)
+			{
+				#if OS_BUDGET_ENFORCEMENT == ENABLE
+
+					OS_BudgetStop(Copy_Priority, Local_PreviousTask, Local_BudgetStart);
+
+				#endif
+
+				#if OS_LOAD_ACCOUNTING == ENABLE
+
+					OS_LoadTaskStop(Copy_Priority, &Local_LoadState);
+
+				#endif
+
+				#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+					OS_HistogramRecord(Copy_Priority, &Local_HistogramState);
+
+				#endif
+
+				Global_RunningTask = Local_PreviousTask;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+
+			/* Release successors of the completed task right away (chains) */
+			Local_Successors = Copy_pSchedular->pTasksArr[Copy_Priority].SuccessorsMask & Copy_pSchedular->ActiveMask;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return Local_Successors;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TaskFreeDescriptor                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_TaskDescriptor_t* Copy_pDescriptor                    */
+/*                 Brief: Descriptor referenced by the task giving it back        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Frees the RAM descriptor of a task created at run time, flash  */
+/*                 and instance descriptors are left as they are (called with     */
+/*                 interrupts off)                                                */
+/*--------------------------------------------------------------------------------*/
+static void OS_TaskFreeDescriptor(const OS_TaskDescriptor_t* Copy_pDescriptor)
+{
+	/* Only descriptors of TASKS_CREATION tasks are kept in RAM */
+	#if NUM_OF_CREATED_TASKS > 0
+
+		/* Local Variables Definitions */
+		uint8_t Local_DescriptorsCounter;			/* A variable to hold descriptor count */
+
+		for(Local_DescriptorsCounter = 0 ; Local_DescriptorsCounter < NUM_OF_CREATED_TASKS ; Local_DescriptorsCounter++)
+		{
+			if(Copy_pDescriptor == &Global_CreatedTasksArr[Local_DescriptorsCounter])
+			{
+				Global_CreatedTasksArr[Local_DescriptorsCounter].pFunction = NULL;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+
+	#endif
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_RegisterDefinedTasks                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Walks the task descriptors of the .os_tasks flash section and  */
+/*                 registers every one whose priority slot is still free          */
+/*--------------------------------------------------------------------------------*/
+static void OS_RegisterDefinedTasks(void)
+{
+	/* Local Variables Definitions */
+	const OS_TaskDescriptor_t* Local_pDescriptor;	/* A variable to hold the descriptor being registered */
+
+	for(Local_pDescriptor = _sos_tasks ; Local_pDescriptor < _eos_tasks ; Local_pDescriptor++)
+	{
+		/* A slot already taken through TASKS_CREATION (or another module) is kept */
+		if(Local_pDescriptor->Priority < NUM_OF_TASKS && Global_TasksArr[Local_pDescriptor->Priority].TaskState == OS_TASK_DELETED)
+		{
+			(void)OS_SchedularTaskRegister(&Global_Schedular, Local_pDescriptor);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SelfTimedSchedule                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the self-timed task                         */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Delay                                            */
+/*                 Brief: OS ticks until its next release or OS_WAIT_FOR_EVENT    */
+/*                 Range: (0 --> OS_MAX_SELF_TIMED_DELAY), longer ones are cut    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_Schedular_t* Copy_pSchedular                                */
+/*                 Brief: Schedular the task belongs to                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the next release of a self-timed task from now            */
+/*--------------------------------------------------------------------------------*/
+static void OS_SelfTimedSchedule(OS_Schedular_t* Copy_pSchedular, uint8_t Copy_Priority, uint32_t Copy_Delay)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	/* The task may have been deleted or replaced while it was running */
+	if(Copy_pSchedular->pTasksArr[Copy_Priority].PointerToSelfTimedFunction != NULL && Copy_Delay != OS_WAIT_FOR_EVENT)
+	{
+		/* A zero delay means the very next tick, a delay past half the tick range would look already due */
+		if(Copy_Delay == 0)
+		{
+			Copy_Delay = 1UL;
+		}
+		else if(Copy_Delay > OS_MAX_SELF_TIMED_DELAY)
+		{
+			Copy_Delay = OS_MAX_SELF_TIMED_DELAY;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		Copy_pSchedular->pTasksArr[Copy_Priority].NextRelease = Copy_pSchedular->TickCounter + Copy_Delay;
+		Copy_pSchedular->SelfTimedWaitingMask |= (1UL << Copy_Priority);
+	}
+	else
+	{
+		/* Only released on demand or by events from now on */
+		Copy_pSchedular->SelfTimedWaitingMask &= ~(1UL << Copy_Priority);
+	}
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TickPass                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : SysTick callback, runs the selected schedular and measures the */
+/*                 CPU cycles it took                                             */
+/*--------------------------------------------------------------------------------*/
+static void OS_TickPass(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_StartCycle = OS_CYCLE_COUNT();	/* A variable to hold cycle count at pass start */
+	uint32_t Local_PassCycles;						/* A variable to hold CPU cycles taken by the pass */
+
+	#if OS_INTERRUPT_LATENCY == ENABLE
+
+		/* SysTick entry latency, the dispatch latency is taken by the first task run */
+		OS_LatencyTickStart();
+
+	#endif
+
+	#if OS_LOAD_ACCOUNTING == ENABLE
+
+		/* The CPU is busy from here to the end of the pass */
+		OS_LoadEnter();
+
+	#endif
+
+	#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+		/* Tasks released by this pass were due at the SysTick instant */
+		OS_HistogramTickStart();
+
+	#endif
+
+	/* Check selected task set based on configuration file */
+	#if   OS_CYCLIC_EXECUTIVE == ENABLE
+
+		/* Table lookup of the tasks of the current minor frame */
+		OS_CyclicExecutive();
+
+	#elif OS_STATIC_TASK_SET == ENABLE
+
+		/* Unrolled dispatch of the task set listed at build time */
+		OS_StaticSchedular();
+
+	#elif OS_STATIC_TASK_SET == DISABLE
+
+		#if OS_PARTITIONING == ENABLE
+
+			/* Switch partition windows before this tick releases tasks */
+			OS_PartitionTick();
+
+		#endif
+
+		/* Table driven dispatch of the tasks created at run time */
+		SCHEDULAR(&Global_Schedular);
+
+	#else
+
+		#error " Wrong OS_STATIC_TASK_SET Configuration !"
+
+	#endif
+
+	Local_PassCycles = OS_CYCLE_COUNT() - Local_StartCycle;
+	Global_DispatchLastCycles = Local_PassCycles;
+
+	if(Local_PassCycles > Global_DispatchMaxCycles)
+	{
+		Global_DispatchMaxCycles = Local_PassCycles;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	#if OS_INTERRUPT_LATENCY == ENABLE
+
+		/* Tasks started from here on were not released by this tick */
+		OS_LatencyTickEnd();
+
+	#endif
+
+	#if OS_OVERLOAD_MANAGEMENT == ENABLE
+
+		/* Degrade or restore tasks depending on the load of this pass */
+		OS_OverloadUpdate(Local_PassCycles);
+
+	#endif
+
+	#if OS_LOAD_ACCOUNTING == ENABLE
+
+		/* Close the load of this tick, then leave the busy time */
+		OS_LoadTick();
+		OS_LoadExit();
+
+	#endif
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            	  INTERRUPT HANDLERS		                    	 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: PendSV Exception Handler, event pass running tasks activated    */
+/*				  by events since the last pass                                   */
+/*--------------------------------------------------------------------------------*/
+void PendSV_Handler(void)
+{
+	#if OS_LOAD_ACCOUNTING == ENABLE
+
+		OS_LoadEnter();
+
+	#endif
+
+	#if OS_LATENCY_HISTOGRAMS == ENABLE
+
+		OS_HistogramEventStart();
+
+	#endif
+
+	/* No periodic release in an event pass */
+	OS_DispatchReadyTasks(&Global_Schedular, 0);
+
+	#if OS_LOAD_ACCOUNTING == ENABLE
+
+		OS_LoadExit();
+
+	#endif
 }
@@ -0,0 +1,436 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS SeqLock                   */
+/*     			    Description	 : OS SeqLock Program File      */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_SeqLock.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockInit                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_SeqLock_t* Copy_pSeqLock                                    */
+/*                 Brief: Pointer to the seqlock to be initialized                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Initializes a seqlock to the stable (even) state               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SeqLockInit(OS_SeqLock_t* Copy_pSeqLock)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSeqLock != NULL)
+	{
+		/* No write has been done yet */
+		Copy_pSeqLock->Sequence = 0;
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockWriteBegin                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_SeqLock_t* Copy_pSeqLock                                    */
+/*                 Brief: Pointer to the seqlock protecting the data to be        */
+/*                        updated in place                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Marks the start of an in place update of the protected data,   */
+/*                 must be paired with OS_SeqLockWriteEnd                         */
+/*--------------------------------------------------------------------------------*/
+void OS_SeqLockWriteBegin(OS_SeqLock_t* Copy_pSeqLock)
+{
+	/* Make the sequence odd so that any reader in the middle of a copy retries */
+	Copy_pSeqLock->Sequence++;
+
+	/* Make sure the sequence update is visible before any data is touched */
+	OS_MEMORY_BARRIER();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockWriteEnd                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_SeqLock_t* Copy_pSeqLock                                    */
+/*                 Brief: Pointer to the seqlock protecting the updated data      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Marks the end of an in place update of the protected data      */
+/*--------------------------------------------------------------------------------*/
+void OS_SeqLockWriteEnd(OS_SeqLock_t* Copy_pSeqLock)
+{
+	/* Make sure all data writes are done before the sequence becomes even again */
+	OS_MEMORY_BARRIER();
+
+	/* Make the sequence even again, data is stable */
+	Copy_pSeqLock->Sequence++;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockReadBegin                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_SeqLock_t* Copy_pSeqLock                              */
+/*                 Brief: Pointer to the seqlock protecting the data to be read   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint32_t                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Samples the sequence before reading the protected data in      */
+/*                 place, the returned value is passed to OS_SeqLockReadRetry     */
+/*--------------------------------------------------------------------------------*/
+uint32_t OS_SeqLockReadBegin(const OS_SeqLock_t* Copy_pSeqLock)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_Sequence = Copy_pSeqLock->Sequence;	/* A variable to hold sequence sampled before the read */
+
+	/* Make sure the sequence is sampled before any data is read */
+	OS_MEMORY_BARRIER();
+
+	return Local_Sequence;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockReadRetry                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_SeqLock_t* Copy_pSeqLock                              */
+/*                 Brief: Pointer to the seqlock protecting the data just read    */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Sequence                                         */
+/*                 Brief: Sequence returned by OS_SeqLockReadBegin                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t (1 if the read was torn and must be retried, else 0)   */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Checks whether a writer touched the data while it was read     */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_SeqLockReadRetry(const OS_SeqLock_t* Copy_pSeqLock, uint32_t Copy_Sequence)
+{
+	/* Make sure all data reads are done before the sequence is sampled again */
+	OS_MEMORY_BARRIER();
+
+	/*
+	 * The read is torn if it started while a write was in progress (odd sequence)
+	 * or if a write started since the read began (sequence changed)
+	 */
+	return ((Copy_Sequence & OS_SEQLOCK_WRITE_IN_PROGRESS) || (Copy_pSeqLock->Sequence != Copy_Sequence));
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockWrite                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const void* Copy_pData                                         */
+/*                 Brief: Pointer to the new value to be published                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Size                                             */
+/*                 Brief: Size of the protected data in bytes                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_SeqLock_t* Copy_pSeqLock                                    */
+/*                 Brief: Pointer to the seqlock protecting the shared data       */
+/*                 -------------------------------------------------------------- */
+/*                 void* Copy_pShared                                             */
+/*                 Brief: Pointer to the shared data to be overwritten            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Copies a new value into the shared data, never blocks and its  */
+/*                 cost only depends on Copy_Size                                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SeqLockWrite(OS_SeqLock_t* Copy_pSeqLock, void* Copy_pShared, const void* Copy_pData, uint32_t Copy_Size)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t* Local_pDestination = (uint8_t*)Copy_pShared;		/* A pointer to walk over the shared data bytes */
+	const uint8_t* Local_pSource = (const uint8_t*)Copy_pData;	/* A pointer to walk over the new value bytes */
+	uint32_t Local_ByteCounter;									/* A variable to hold count of copied bytes */
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pSeqLock != NULL && Copy_pShared != NULL && Copy_pData != NULL)
+	{
+		/* Let readers know that the data is being changed */
+		OS_SeqLockWriteBegin(Copy_pSeqLock);
+
+		/* Copy the new value into the shared data */
+		for(Local_ByteCounter = 0 ; Local_ByteCounter < Copy_Size ; Local_ByteCounter++)
+		{
+			Local_pDestination[Local_ByteCounter] = Local_pSource[Local_ByteCounter];
+		}
+
+		/* Let readers know that the data is stable again */
+		OS_SeqLockWriteEnd(Copy_pSeqLock);
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SeqLockRead                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_SeqLock_t* Copy_pSeqLock                              */
+/*                 Brief: Pointer to the seqlock protecting the shared data       */
+/*                 -------------------------------------------------------------- */
+/*                 const void* Copy_pShared                                       */
+/*                 Brief: Pointer to the shared data to be read                   */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Size                                             */
+/*                 Brief: Size of the protected data in bytes                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : void* Copy_pData                                               */
+/*                 Brief: Pointer to where the consistent snapshot is copied      */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pVersion                                        */
+/*                 Brief: Number of writes the snapshot reflects (may be NULL)    */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Copies a consistent snapshot of the shared data, retrying up   */
+/*                 to OS_SEQLOCK_MAX_RETRIES times when a write tears the copy    */
+/*                 and returning BUSY_FUNC if every attempt was torn              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SeqLockRead(const OS_SeqLock_t* Copy_pSeqLock, const void* Copy_pShared, void* Copy_pData, uint32_t Copy_Size, uint32_t* Copy_pVersion)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = BUSY_FUNC;
+	const uint8_t* Local_pSource = (const uint8_t*)Copy_pShared;	/* A pointer to walk over the shared data bytes */
+	uint8_t* Local_pDestination = (uint8_t*)Copy_pData;				/* A pointer to walk over the snapshot bytes */
+	uint32_t Local_Sequence;										/* A variable to hold sequence sampled before the copy */
+	uint32_t Local_ByteCounter;										/* A variable to hold count of copied bytes */
+	uint8_t Local_TriesCounter;										/* A variable to hold count of copy attempts */
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pSeqLock != NULL && Copy_pShared != NULL && Copy_pData != NULL)
+	{
+		for(Local_TriesCounter = 0 ; Local_TriesCounter < OS_SEQLOCK_MAX_RETRIES ; Local_TriesCounter++)
+		{
+			/* Sample the sequence before copying */
+			Local_Sequence = OS_SeqLockReadBegin(Copy_pSeqLock);
+
+			/* Copy the shared data into the snapshot */
+			for(Local_ByteCounter = 0 ; Local_ByteCounter < Copy_Size ; Local_ByteCounter++)
+			{
+				Local_pDestination[Local_ByteCounter] = Local_pSource[Local_ByteCounter];
+			}
+
+			/* Check if the snapshot is consistent or a write overlapped the copy */
+			if(!OS_SeqLockReadRetry(Copy_pSeqLock, Local_Sequence))
+			{
+				/* Each completed write adds 2 to the sequence */
+				if(Copy_pVersion != NULL)
+				{
+					*Copy_pVersion = Local_Sequence >> 1;
+				}
+
+				Local_Status = RT_OK;
+				break;
+			}
+			else
+			{
+				/* Do Nothing (Retry) */
+			}
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TripleBufferInit                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void* Copy_pBuffer0, void* Copy_pBuffer1, void* Copy_pBuffer2  */
+/*                 Brief: Three buffers of the same type to rotate between the    */
+/*                        writer and the reader                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_TripleBuffer_t* Copy_pTripleBuffer                          */
+/*                 Brief: Pointer to the triple buffer to be initialized          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Initializes a triple buffer over three user supplied buffers   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TripleBufferInit(OS_TripleBuffer_t* Copy_pTripleBuffer, void* Copy_pBuffer0, void* Copy_pBuffer1, void* Copy_pBuffer2)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pTripleBuffer != NULL && Copy_pBuffer0 != NULL && Copy_pBuffer1 != NULL && Copy_pBuffer2 != NULL)
+	{
+		/* Register the three buffers */
+		Copy_pTripleBuffer->pBuffers[0] = Copy_pBuffer0;
+		Copy_pTripleBuffer->pBuffers[1] = Copy_pBuffer1;
+		Copy_pTripleBuffer->pBuffers[2] = Copy_pBuffer2;
+
+		/* Writer owns buffer 0, buffer 1 is in the middle and reader owns buffer 2 */
+		Copy_pTripleBuffer->WriteIndex = 0;
+		Copy_pTripleBuffer->State = 1;
+		Copy_pTripleBuffer->ReadIndex = 2;
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TripleBufferGetWriteBuffer                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : const OS_TripleBuffer_t* Copy_pTripleBuffer                    */
+/*                 Brief: Pointer to the triple buffer                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void* (buffer the writer may fill)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns the buffer owned by the writer, it stays private to    */
+/*                 the writer until OS_TripleBufferPublish is called              */
+/*--------------------------------------------------------------------------------*/
+void* OS_TripleBufferGetWriteBuffer(const OS_TripleBuffer_t* Copy_pTripleBuffer)
+{
+	return Copy_pTripleBuffer->pBuffers[Copy_pTripleBuffer->WriteIndex];
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TripleBufferPublish                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_TripleBuffer_t* Copy_pTripleBuffer                          */
+/*                 Brief: Pointer to the triple buffer                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Publishes the filled write buffer as the latest value through  */
+/*                 a single atomic swap with the middle buffer                    */
+/*--------------------------------------------------------------------------------*/
+void OS_TripleBufferPublish(OS_TripleBuffer_t* Copy_pTripleBuffer)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_OldState;		/* A variable to hold state before the swap */
+
+	/* Make sure the buffer content is complete before it is handed over */
+	OS_MEMORY_BARRIER();
+
+	/* Put the filled buffer in the middle flagged as new data and take the old middle one */
+	Local_OldState = OS_ATOMIC_EXCHANGE(&Copy_pTripleBuffer->State, Copy_pTripleBuffer->WriteIndex | OS_TRIPLE_BUFFER_NEW_DATA);
+
+	/* The old middle buffer is the next one to be filled by the writer */
+	Copy_pTripleBuffer->WriteIndex = (uint8_t)(Local_OldState & OS_TRIPLE_BUFFER_INDEX_MASK);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TripleBufferGetReadBuffer                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : OS_TripleBuffer_t* Copy_pTripleBuffer                          */
+/*                 Brief: Pointer to the triple buffer                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint8_t* Copy_pNewData                                         */
+/*                 Brief: Set to 1 if a new value was published since the last    */
+/*                        call, else 0 (may be NULL)                              */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : const void* (buffer holding the latest published value)        */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Returns the latest published value, swapping buffers with the  */
+/*                 writer only when new data is available. The returned buffer    */
+/*                 stays valid until the next call                                */
+/*--------------------------------------------------------------------------------*/
+const void* OS_TripleBufferGetReadBuffer(OS_TripleBuffer_t* Copy_pTripleBuffer, uint8_t* Copy_pNewData)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_OldState;		/* A variable to hold state before the swap */
+	uint8_t Local_NewData = 0;		/* A variable to hold whether new data was taken */
+
+	/* Check if the writer published a new value since the last read */
+	if(Copy_pTripleBuffer->State & OS_TRIPLE_BUFFER_NEW_DATA)
+	{
+		/* Put the already read buffer in the middle and take the newly published one */
+		Local_OldState = OS_ATOMIC_EXCHANGE(&Copy_pTripleBuffer->State, Copy_pTripleBuffer->ReadIndex);
+		Copy_pTripleBuffer->ReadIndex = (uint8_t)(Local_OldState & OS_TRIPLE_BUFFER_INDEX_MASK);
+
+		/* Make sure the buffer content is read only after it has been taken */
+		OS_MEMORY_BARRIER();
+
+		Local_NewData = 1;
+	}
+	else
+	{
+		/* Do Nothing (Keep the current buffer) */
+	}
+
+	if(Copy_pNewData != NULL)
+	{
+		*Copy_pNewData = Local_NewData;
+	}
+
+	return Copy_pTripleBuffer->pBuffers[Copy_pTripleBuffer->ReadIndex];
+}
@@ -0,0 +1,313 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Server                    */
+/*     			    Description	 : OS Server Program File       */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Server.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+OS_Job_t Global_ServerQueue[OS_SERVER_QUEUE_SIZE];	/* Global array that holds jobs waiting for the server (FIFO) */
+volatile uint8_t Global_ServerQueueHead = 0;		/* Global variable that holds index of the oldest queued job */
+volatile uint8_t Global_ServerQueueCount = 0;		/* Global variable that holds number of queued jobs */
+uint8_t Global_ServerPriority;						/* Global variable that holds priority of the server task */
+uint8_t Global_ServerPeriod;						/* Global variable that holds replenishment period in OS ticks */
+sint32_t Global_ServerCapacity;						/* Global variable that holds budget given every period in cycles */
+uint32_t Global_ServerPeriodStart = 0;				/* Global variable that holds tick at which the current period started */
+volatile OS_ServerStats_t Global_ServerStats;		/* Global variable that holds server statistics and budget left */
+static OS_TaskDescriptor_t Global_ServerDescriptor;	/* Global variable that holds descriptor of the server task */
+
+extern OS_Schedular_t Global_Schedular;					/* Default schedular the server task is registered in */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void OS_ServerTask(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ServerInit                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the server task                             */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_BudgetUs                                         */
+/*                 Brief: Execution time the server may use every period in us    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_ReplenishmentPeriod                               */
+/*                 Brief: Budget replenishment period in OS ticks                 */
+/*                 Range: (1 --> 255)                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates the server task with a full budget and an empty queue, */
+/*                 must be called before OS_Init like TASKS_CREATION              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ServerInit(uint8_t Copy_Priority, uint32_t Copy_BudgetUs, uint8_t Copy_ReplenishmentPeriod)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed priority, budget and period are within valid range or not */
+	if(Copy_Priority < NUM_OF_TASKS && Copy_BudgetUs != 0 && Copy_ReplenishmentPeriod != 0)
+	{
+		/* Start with an empty queue */
+		Global_ServerQueueHead = 0;
+		Global_ServerQueueCount = 0;
+
+		/* Store the server parameters and give it a full budget */
+		Global_ServerPriority = Copy_Priority;
+		Global_ServerPeriod = Copy_ReplenishmentPeriod;
+		Global_ServerCapacity = (sint32_t)OS_US_TO_CYCLES(Copy_BudgetUs);
+		Global_ServerPeriodStart = 0;
+		Global_ServerStats.Budget = Global_ServerCapacity;
+
+		/*
+		 * Register the server as a periodic task so that it is released at every
+		 * replenishment even if no job was posted while it had no budget left
+		 */
+		Global_ServerDescriptor.pFunction = OS_ServerTask;
+		Global_ServerDescriptor.Priority = Copy_Priority;
+		Global_ServerDescriptor.Periodicity = Copy_ReplenishmentPeriod;
+		Global_ServerDescriptor.Offset = 0;
+		Local_Status = OS_SchedularTaskRegister(&Global_Schedular, &Global_ServerDescriptor);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ServerPostJob                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void (*Copy_pJobFunction)(uint32_t)                            */
+/*                 Brief: Job function to be executed by the server               */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_Argument                                         */
+/*                 Brief: Argument passed to the job function                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t (BUSY_FUNC if the queue is full)                */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Queues an aperiodic job and activates the server through an   */
+/*                 event pass if it has budget left, safe to be called from tasks */
+/*                 and ISRs                                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ServerPostJob(void (*Copy_pJobFunction)(uint32_t), uint32_t Copy_Argument)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptState;		/* A variable to hold interrupts state before the critical section */
+	uint8_t Local_Tail;					/* A variable to hold index of the first free queue entry */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pJobFunction != NULL)
+	{
+		/* Queue manipulation must not be interleaved with another post or with the server */
+		OS_ENTER_CRITICAL(Local_InterruptState);
+
+		if(Global_ServerQueueCount < OS_SERVER_QUEUE_SIZE)
+		{
+			/* Add the job at the tail of the queue */
+			Local_Tail = (Global_ServerQueueHead + Global_ServerQueueCount) % OS_SERVER_QUEUE_SIZE;
+			Global_ServerQueue[Local_Tail].pJobFunction = Copy_pJobFunction;
+			Global_ServerQueue[Local_Tail].Argument = Copy_Argument;
+			Global_ServerQueue[Local_Tail].PostTime = OS_CYCLE_COUNT();
+			Global_ServerQueueCount++;
+		}
+		else
+		{
+			/* Queue is full */
+			Global_ServerStats.JobsDropped++;
+			Local_Status = BUSY_FUNC;
+		}
+
+		OS_EXIT_CRITICAL(Local_InterruptState);
+
+		/* Serve the job right away if the server still has budget, else wait for replenishment */
+		if(Local_Status == RT_OK && Global_ServerStats.Budget > 0)
+		{
+			(void)OS_TaskActivate(Global_ServerPriority);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ServerGetStats                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : OS_ServerStats_t* Copy_pStats                                  */
+/*                 Brief: Pointer to where the server statistics are copied       */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets served/dropped job counts, job response times and the     */
+/*                 budget left in the current period                              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_ServerGetStats(OS_ServerStats_t* Copy_pStats)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_InterruptState;		/* A variable to hold interrupts state before the critical section */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pStats != NULL)
+	{
+		/* Take a consistent copy of the statistics */
+		OS_ENTER_CRITICAL(Local_InterruptState);
+		*Copy_pStats = Global_ServerStats;
+		OS_EXIT_CRITICAL(Local_InterruptState);
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                         PRIVATE FUNCTIONS IMPLEMENTATIONS                         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_ServerTask                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Server task body, replenishes the budget once per period then  */
+/*                 runs queued jobs in FIFO order while budget is left            */
+/*--------------------------------------------------------------------------------*/
+static void OS_ServerTask(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_TickCount = OS_GetTickCount();	/* A variable to hold current OS tick */
+	uint32_t Local_PeriodStart;						/* A variable to hold tick at which the current period started */
+	uint32_t Local_InterruptState;					/* A variable to hold interrupts state before the critical section */
+	uint32_t Local_StartTime;						/* A variable to hold cycle count before running a job */
+	uint32_t Local_EndTime;							/* A variable to hold cycle count after running a job */
+	OS_Job_t Local_Job;								/* A variable to hold the job being served */
+	uint8_t Local_JobAvailable;						/* A variable to hold whether a job was taken from the queue */
+
+	/* Replenish the budget once at the start of every period */
+	Local_PeriodStart = Local_TickCount - (Local_TickCount % Global_ServerPeriod);
+
+	if(Local_PeriodStart != Global_ServerPeriodStart)
+	{
+		Global_ServerPeriodStart = Local_PeriodStart;
+
+		/* Unused budget is lost at the end of a period while an overrun is paid back */
+		if(Global_ServerStats.Budget > 0)
+		{
+			Global_ServerStats.Budget = Global_ServerCapacity;
+		}
+		else
+		{
+			Global_ServerStats.Budget += Global_ServerCapacity;
+		}
+	}
+	else
+	{
+		/* Do Nothing (Still within the current period) */
+	}
+
+	/* Serve queued jobs while budget is left */
+	while(Global_ServerStats.Budget > 0)
+	{
+		/* Take the oldest job out of the queue */
+		OS_ENTER_CRITICAL(Local_InterruptState);
+
+		Local_JobAvailable = (Global_ServerQueueCount != 0);
+
+		if(Local_JobAvailable)
+		{
+			Local_Job = Global_ServerQueue[Global_ServerQueueHead];
+			Global_ServerQueueHead = (Global_ServerQueueHead + 1) % OS_SERVER_QUEUE_SIZE;
+			Global_ServerQueueCount--;
+		}
+
+		OS_EXIT_CRITICAL(Local_InterruptState);
+
+		if(!Local_JobAvailable)
+		{
+			/* Queue is empty, keep the rest of the budget for jobs posted later in this period */
+			break;
+		}
+
+		/* Run the job and charge its execution time to the budget */
+		Local_StartTime = OS_CYCLE_COUNT();
+		Local_Job.pJobFunction(Local_Job.Argument);
+		Local_EndTime = OS_CYCLE_COUNT();
+
+		Global_ServerStats.Budget -= (sint32_t)(Local_EndTime - Local_StartTime);
+
+		/* Update the response time statistics */
+		Global_ServerStats.JobsServed++;
+		Global_ServerStats.LastResponseTime = Local_EndTime - Local_Job.PostTime;
+
+		if(Global_ServerStats.LastResponseTime > Global_ServerStats.MaxResponseTime)
+		{
+			Global_ServerStats.MaxResponseTime = Global_ServerStats.LastResponseTime;
+		}
+	}
+}
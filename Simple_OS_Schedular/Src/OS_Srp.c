@@ -0,0 +1,328 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Srp                       */
+/*     			    Description	 : OS Srp Program File          */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Srp.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+const uint8_t Global_SrpTaskIrqsArr[OS_SRP_MAX_TASKS] = OS_SRP_TASK_IRQS;	/* Global array that holds IRQ of every task (by task priority) */
+
+uint8_t Global_ResourceCeilingsArr[OS_NUM_OF_RESOURCES];	/* Global array that holds BASEPRI value of every resource ceiling (0 if not created) */
+
+#if OS_SCHEDULING_MODE == OS_PREEMPTIVE_SRP
+
+	#if (NUM_OF_TASKS > OS_SRP_MAX_TASKS) || (OS_SRP_HIGHEST_TASK_LEVEL == 0) || ((OS_SRP_HIGHEST_TASK_LEVEL + NUM_OF_TASKS) > 15)
+
+		#error " Wrong OS_PREEMPTIVE_SRP Task Levels Configuration !"
+
+	#endif
+
+#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpInit                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Sets the NVIC level of the IRQ of every task and enables it,   */
+/*                 called by OS_Init in OS_PREEMPTIVE_SRP mode                    */
+/*--------------------------------------------------------------------------------*/
+void OS_SrpInit(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_TasksCounter;					/* A variable to hold task count */
+	uint8_t Local_Irq;							/* A variable to hold IRQ of the current task */
+
+	for(Local_TasksCounter = 0 ; Local_TasksCounter < NUM_OF_TASKS ; Local_TasksCounter++)
+	{
+		Local_Irq = Global_SrpTaskIrqsArr[Local_TasksCounter];
+
+		/* Task 0 gets the highest task level, each next task one level lower */
+		NVIC_IPR[Local_Irq] = (uint8_t)((OS_SRP_HIGHEST_TASK_LEVEL + Local_TasksCounter) << OS_NVIC_PRIORITY_SHIFT);
+		NVIC_ISER[Local_Irq >> 5] = (1UL << (Local_Irq & 0x1FU));
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpPendTasks                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_ReadyTasks                                       */
+/*                 Brief: One bit per task to be run (bit number = task priority) */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Pends the IRQs of the passed tasks, the NVIC runs them in      */
+/*                 priority order                                                 */
+/*--------------------------------------------------------------------------------*/
+void OS_SrpPendTasks(uint32_t Copy_ReadyTasks)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_TasksCounter;					/* A variable to hold task count */
+	uint8_t Local_Irq;							/* A variable to hold IRQ of the current task */
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	/* Pend all tasks before any of them starts, so the first to run is the highest priority one */
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	while(Copy_ReadyTasks != 0)
+	{
+		Local_TasksCounter = (uint8_t)__builtin_ctzl(Copy_ReadyTasks);
+		CLEAR_BIT(Copy_ReadyTasks, Local_TasksCounter);
+
+		Local_Irq = Global_SrpTaskIrqsArr[Local_TasksCounter];
+		NVIC_ISPR[Local_Irq >> 5] = (1UL << (Local_Irq & 0x1FU));
+	}
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpSetTaskLevel                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_Priority                                          */
+/*                 Brief: Priority of the task                                    */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Level                                             */
+/*                 Brief: NVIC level given to the IRQ of the task                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Changes the NVIC level of a task, the level of a running task  */
+/*                 takes effect right away (used to demote a task over budget)    */
+/*--------------------------------------------------------------------------------*/
+void OS_SrpSetTaskLevel(uint8_t Copy_Priority, uint8_t Copy_Level)
+{
+	/* Check if passed priority belongs to a task in the system or not */
+	if(Copy_Priority < NUM_OF_TASKS)
+	{
+		NVIC_IPR[Global_SrpTaskIrqsArr[Copy_Priority]] = (uint8_t)(Copy_Level << OS_NVIC_PRIORITY_SHIFT);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpResourceCreate                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_ResourceId                                        */
+/*                 Brief: Index of the resource                                   */
+/*                 Range: (0 --> OS_NUM_OF_RESOURCES - 1)                         */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_UsersMask                                        */
+/*                 Brief: One bit per task using the resource (bit number = task  */
+/*                        priority)                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a resource and computes its ceiling from its users     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SrpResourceCreate(uint8_t Copy_ResourceId, uint32_t Copy_UsersMask)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed resource index is within valid range and passed users are tasks in the system or not */
+	if(Copy_ResourceId < OS_NUM_OF_RESOURCES && Copy_UsersMask != 0 && (Copy_UsersMask & ~OS_ALL_TASKS_MASK) == 0)
+	{
+		/* The ceiling is the level of the highest priority user (lowest set bit) */
+		Global_ResourceCeilingsArr[Copy_ResourceId] =
+			(uint8_t)((OS_SRP_HIGHEST_TASK_LEVEL + __builtin_ctzl(Copy_UsersMask)) << OS_NVIC_PRIORITY_SHIFT);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpResourceLock                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_ResourceId                                        */
+/*                 Brief: Index of the resource to be locked                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pPreviousCeiling                                */
+/*                 Brief: System ceiling before the lock, to be passed back to    */
+/*                        OS_SrpResourceUnlock                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Locks a resource by raising the system ceiling to its ceiling, */
+/*                 locks nest and are released in reverse order                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_SrpResourceLock(uint8_t Copy_ResourceId, uint32_t* Copy_pPreviousCeiling)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pPreviousCeiling != NULL)
+	{
+		/* Check if passed resource is created or not */
+		if(Copy_ResourceId < OS_NUM_OF_RESOURCES && Global_ResourceCeilingsArr[Copy_ResourceId] != 0)
+		{
+			#if   OS_SCHEDULING_MODE == OS_PREEMPTIVE_SRP
+
+				/* Raise the system ceiling, a lower ceiling already set by an outer lock is kept */
+				OS_READ_BASEPRI(*Copy_pPreviousCeiling);
+				OS_RAISE_BASEPRI((uint32_t)Global_ResourceCeilingsArr[Copy_ResourceId]);
+
+			#elif OS_SCHEDULING_MODE == OS_COOPERATIVE
+
+				/* Tasks never preempt each other, nothing to lock */
+				*Copy_pPreviousCeiling = 0;
+
+			#else
+
+				#error " Wrong OS Scheduling Mode Configuration !"
+
+			#endif
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_SrpResourceUnlock                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_PreviousCeiling                                  */
+/*                 Brief: System ceiling returned by the matching lock            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Unlocks a resource by restoring the system ceiling, tasks held */
+/*                 back by the lock start right away                              */
+/*--------------------------------------------------------------------------------*/
+void OS_SrpResourceUnlock(uint32_t Copy_PreviousCeiling)
+{
+	#if OS_SCHEDULING_MODE == OS_PREEMPTIVE_SRP
+
+		OS_WRITE_BASEPRI(Copy_PreviousCeiling);
+
+	#else
+
+		/* Tasks never preempt each other, nothing to unlock */
+		(void)Copy_PreviousCeiling;
+
+	#endif
+}
+
+#if OS_SCHEDULING_MODE == OS_PREEMPTIVE_SRP
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            	  INTERRUPT HANDLERS		                    	 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: Task IRQ Handlers, each runs the task of its priority then      */
+/*				  pends the successors the task released                          */
+/*--------------------------------------------------------------------------------*/
+void CAN_RX1_IRQHandler(void)
+{
+	OS_SrpPendTasks(OS_ExecuteTask(0));
+}
+
+void CAN_SCE_IRQHandler(void)
+{
+	OS_SrpPendTasks(OS_ExecuteTask(1));
+}
+
+void I2C2_EV_IRQHandler(void)
+{
+	OS_SrpPendTasks(OS_ExecuteTask(2));
+}
+
+void I2C2_ER_IRQHandler(void)
+{
+	OS_SrpPendTasks(OS_ExecuteTask(3));
+}
+
+void SPI2_IRQHandler(void)
+{
+	OS_SrpPendTasks(OS_ExecuteTask(4));
+}
+
+void USART3_IRQHandler(void)
+{
+	OS_SrpPendTasks(OS_ExecuteTask(5));
+}
+
+void TAMPER_IRQHandler(void)
+{
+	OS_SrpPendTasks(OS_ExecuteTask(6));
+}
+
+void FLASH_IRQHandler(void)
+{
+	OS_SrpPendTasks(OS_ExecuteTask(7));
+}
+
+#endif
@@ -0,0 +1,354 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Stack                     */
+/*     			    Description	 : OS Stack Program File        */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Idle.h"
+#include "OS_Stack.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef struct
+{
+	const uint32_t* pBase;				/* Lowest word of the region (NULL if not registered) */
+	const uint32_t* pTop;				/* Word right above the region */
+	const uint32_t* volatile pMark;		/* Lowest word known to be used (high-water mark) */
+}OS_StackRegion_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static OS_StackRegion_t Global_StackRegionsArr[OS_NUM_OF_STACK_REGIONS];	/* Stack regions watched by the scan job */
+static uint8_t Global_StackScanRegion = 0;									/* Region being scanned by the scan job */
+static const uint32_t* Global_pStackScanCursor = NULL;						/* Next word to be checked (NULL at the start of a region) */
+
+/* Linker script symbols bounding the stack: top of RAM, end of .bss and the heap reserved after it */
+extern uint32_t _estack;
+extern uint32_t _ebss;
+extern uint32_t _Min_Heap_Size;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackPaint                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Fills the free stack (from the end of the heap up to the       */
+/*                 current stack pointer) with the paint pattern, called by       */
+/*                 OS_Init                                                        */
+/*--------------------------------------------------------------------------------*/
+void OS_StackPaint(void)
+{
+	/* Local Variables Definitions */
+	uint32_t* Local_pWord;						/* A variable to hold address of the word being painted */
+	uint32_t Local_StackPointer;				/* A variable to hold current stack pointer */
+	uint32_t Local_InterruptsState;				/* A variable to hold interrupts state before the critical section */
+
+	/* No interrupt frame may be pushed below the stack pointer while it is being painted */
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	OS_READ_SP(Local_StackPointer);
+
+	for(Local_pWord = (uint32_t*)((uint32_t)&_ebss + (uint32_t)&_Min_Heap_Size) ; (uint32_t)Local_pWord < Local_StackPointer ; Local_pWord++)
+	{
+		*Local_pWord = OS_STACK_PAINT_PATTERN;
+	}
+
+	/* The main stack is the first region of the scan job, already used down to the stack pointer */
+	Global_StackRegionsArr[OS_STACK_MAIN].pBase = (const uint32_t*)((uint32_t)&_ebss + (uint32_t)&_Min_Heap_Size);
+	Global_StackRegionsArr[OS_STACK_MAIN].pTop = &_estack;
+	Global_StackRegionsArr[OS_STACK_MAIN].pMark = Local_pWord;
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackGetPeakUsage                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pPeakBytes                                      */
+/*                 Brief: Deepest stack usage seen since OS_Init in bytes         */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pSizeBytes                                      */
+/*                 Brief: Size of the stack region in bytes (may be NULL)         */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the peak usage of the main stack                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_StackGetPeakUsage(uint32_t* Copy_pPeakBytes, uint32_t* Copy_pSizeBytes)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	const uint32_t* Local_pWord;				/* A variable to hold address of the word being checked */
+	const uint32_t* Local_pStackBottom;			/* A variable to hold lowest address the stack may reach */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pPeakBytes != NULL)
+	{
+		Local_pStackBottom = (const uint32_t*)((uint32_t)&_ebss + (uint32_t)&_Min_Heap_Size);
+
+		/* The stack grows down, the first word that lost the pattern marks the deepest use */
+		for(Local_pWord = Local_pStackBottom ; Local_pWord < &_estack && *Local_pWord == OS_STACK_PAINT_PATTERN ; Local_pWord++)
+		{
+			/* Do Nothing */
+		}
+
+		*Copy_pPeakBytes = (uint32_t)&_estack - (uint32_t)Local_pWord;
+
+		if(Copy_pSizeBytes != NULL)
+		{
+			*Copy_pSizeBytes = (uint32_t)&_estack - (uint32_t)Local_pStackBottom;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackRegionRegister                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_RegionId                                          */
+/*                 Brief: Index of the region in the stack regions table          */
+/*                 Range: (1 --> OS_NUM_OF_STACK_REGIONS - 1)                     */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t Copy_SizeBytes                                        */
+/*                 Brief: Size of the stack in bytes (multiple of 4)              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : uint32_t* Copy_pBase                                           */
+/*                 Brief: Lowest address of the stack (word aligned)              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Paints a stack not in use yet and adds it to the regions       */
+/*                 watched by the stack scan background job                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_StackRegionRegister(uint8_t Copy_RegionId, uint32_t* Copy_pBase, uint32_t Copy_SizeBytes)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t* Local_pWord;						/* A variable to hold address of the word being painted */
+	uint32_t* Local_pTop;						/* A variable to hold address right above the region */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pBase != NULL)
+	{
+		/* Check if passed region index and size are valid or not, the main stack region is set by OS_Init */
+		if(Copy_RegionId != OS_STACK_MAIN && Copy_RegionId < OS_NUM_OF_STACK_REGIONS && Copy_SizeBytes != 0 && (Copy_SizeBytes % sizeof(uint32_t)) == 0)
+		{
+			Local_pTop = Copy_pBase + (Copy_SizeBytes / sizeof(uint32_t));
+
+			for(Local_pWord = Copy_pBase ; Local_pWord < Local_pTop ; Local_pWord++)
+			{
+				*Local_pWord = OS_STACK_PAINT_PATTERN;
+			}
+
+			/* Hide the region from the scan job until it is fully set */
+			Global_StackRegionsArr[Copy_RegionId].pBase = NULL;
+			Global_StackRegionsArr[Copy_RegionId].pTop = Local_pTop;
+			Global_StackRegionsArr[Copy_RegionId].pMark = Local_pTop;
+			OS_MEMORY_BARRIER();
+			Global_StackRegionsArr[Copy_RegionId].pBase = Copy_pBase;
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackGetHighWaterMark                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_RegionId                                          */
+/*                 Brief: Index of the region (OS_STACK_MAIN for the main stack)  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pPeakBytes                                      */
+/*                 Brief: Deepest usage found by the stack scan job in bytes      */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pSizeBytes                                      */
+/*                 Brief: Size of the region in bytes (may be NULL)               */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the high-water mark of a stack region without scanning it */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_StackGetHighWaterMark(uint8_t Copy_RegionId, uint32_t* Copy_pPeakBytes, uint32_t* Copy_pSizeBytes)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pPeakBytes != NULL)
+	{
+		/* Check if passed region is registered or not */
+		if(Copy_RegionId < OS_NUM_OF_STACK_REGIONS && Global_StackRegionsArr[Copy_RegionId].pBase != NULL)
+		{
+			*Copy_pPeakBytes = (uint32_t)Global_StackRegionsArr[Copy_RegionId].pTop - (uint32_t)Global_StackRegionsArr[Copy_RegionId].pMark;
+
+			if(Copy_pSizeBytes != NULL)
+			{
+				*Copy_pSizeBytes = (uint32_t)Global_StackRegionsArr[Copy_RegionId].pTop - (uint32_t)Global_StackRegionsArr[Copy_RegionId].pBase;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StackScanJob                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : uint8_t (OS_IDLE_JOB_DONE once every region was scanned)       */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Ready made background job checking OS_STACK_SCAN_SLICE stack   */
+/*                 words per call, pass it to OS_IdleJobCreate                    */
+/*--------------------------------------------------------------------------------*/
+uint8_t OS_StackScanJob(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_JobStatus = OS_IDLE_JOB_PENDING;
+	OS_StackRegion_t* Local_pRegion;			/* A variable to hold the region being scanned */
+	const uint32_t* Local_pMark;				/* A variable to hold high-water mark of the region */
+	uint32_t Local_WordsLeft = OS_STACK_SCAN_SLICE;	/* A variable to hold words still to be checked in this slice */
+
+	Local_pRegion = &Global_StackRegionsArr[Global_StackScanRegion];
+
+	if(Local_pRegion->pBase != NULL)
+	{
+		/* A round checks the region upward from its base, words over the mark are known to be used */
+		if(Global_pStackScanCursor == NULL)
+		{
+			Global_pStackScanCursor = Local_pRegion->pBase;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		Local_pMark = Local_pRegion->pMark;
+
+		while(Local_WordsLeft != 0 && Global_pStackScanCursor < Local_pMark && *Global_pStackScanCursor == OS_STACK_PAINT_PATTERN)
+		{
+			Global_pStackScanCursor++;
+			Local_WordsLeft--;
+		}
+
+		if(Global_pStackScanCursor < Local_pMark && Local_WordsLeft != 0)
+		{
+			/* The stack went deeper than the mark since the last round */
+			Local_pRegion->pMark = Global_pStackScanCursor;
+			Global_pStackScanCursor = NULL;
+		}
+		else if(Global_pStackScanCursor >= Local_pMark)
+		{
+			/* No deeper use, the mark holds */
+			Global_pStackScanCursor = NULL;
+		}
+		else
+		{
+			/* Slice over, carry on from here on the next call */
+		}
+	}
+	else
+	{
+		/* Region not registered, nothing to scan */
+		Global_pStackScanCursor = NULL;
+	}
+
+	/* Go to the next region once this one is done, the round ends after the last one */
+	if(Global_pStackScanCursor == NULL)
+	{
+		Global_StackScanRegion++;
+
+		if(Global_StackScanRegion == OS_NUM_OF_STACK_REGIONS)
+		{
+			Global_StackScanRegion = 0;
+			Local_JobStatus = OS_IDLE_JOB_DONE;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	return Local_JobStatus;
+}
@@ -0,0 +1,195 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Static Schedular          */
+/*     			    Description	 : OS Static Schedular Program File */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_Load.h"
+#include "OS_StaticSchedular.h"
+
+#if OS_STATIC_TASK_SET == ENABLE
+
+	#if OS_SCHEDULING_MODE != OS_COOPERATIVE
+
+		#error " OS_STATIC_TASK_SET Requires OS_COOPERATIVE Scheduling Mode !"
+
+	#endif
+
+	#if OS_BUDGET_ENFORCEMENT != DISABLE || OS_LATENCY_HISTOGRAMS != DISABLE
+
+		#error " OS_STATIC_TASK_SET Requires OS_BUDGET_ENFORCEMENT And OS_LATENCY_HISTOGRAMS Disabled !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     MACROS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Declare every listed task function */
+#define OS_STATIC_DECLARE(Copy_Function,Copy_Periodicity)		void Copy_Function(void);
+
+/*
+ * Fold the listed periods into the hyperperiod (their least common multiple) at compile time,
+ * every task adds a chain of enumerators to OS_STATIC_LCM_t: the first one takes the multiple of
+ * the previous tasks plus one, then Euclid's algorithm runs on that multiple and the period of the
+ * task (one step per enumerator pair) and the last one takes the multiple including the task
+ */
+#define OS_STATIC_GCD_STEP(Copy_Function,Copy_Step,Copy_Next)																	\
+		OS_STATIC_GCD_A_##Copy_Function##_##Copy_Next = (OS_STATIC_GCD_B_##Copy_Function##_##Copy_Step == 0) ?				\
+			OS_STATIC_GCD_A_##Copy_Function##_##Copy_Step : OS_STATIC_GCD_B_##Copy_Function##_##Copy_Step,					\
+		OS_STATIC_GCD_B_##Copy_Function##_##Copy_Next = (OS_STATIC_GCD_B_##Copy_Function##_##Copy_Step == 0) ?				\
+			0 : (OS_STATIC_GCD_A_##Copy_Function##_##Copy_Step % OS_STATIC_GCD_B_##Copy_Function##_##Copy_Step),
+
+#define OS_STATIC_GCD_STEPS(Copy_Function)													\
+		OS_STATIC_GCD_STEP(Copy_Function,0,1) OS_STATIC_GCD_STEP(Copy_Function,1,2) OS_STATIC_GCD_STEP(Copy_Function,2,3) OS_STATIC_GCD_STEP(Copy_Function,3,4) \
+		OS_STATIC_GCD_STEP(Copy_Function,4,5) OS_STATIC_GCD_STEP(Copy_Function,5,6) OS_STATIC_GCD_STEP(Copy_Function,6,7) OS_STATIC_GCD_STEP(Copy_Function,7,8) \
+		OS_STATIC_GCD_STEP(Copy_Function,8,9) OS_STATIC_GCD_STEP(Copy_Function,9,10) OS_STATIC_GCD_STEP(Copy_Function,10,11) OS_STATIC_GCD_STEP(Copy_Function,11,12) \
+		OS_STATIC_GCD_STEP(Copy_Function,12,13) OS_STATIC_GCD_STEP(Copy_Function,13,14) OS_STATIC_GCD_STEP(Copy_Function,14,15) OS_STATIC_GCD_STEP(Copy_Function,15,16) \
+		OS_STATIC_GCD_STEP(Copy_Function,16,17) OS_STATIC_GCD_STEP(Copy_Function,17,18) OS_STATIC_GCD_STEP(Copy_Function,18,19) OS_STATIC_GCD_STEP(Copy_Function,19,20) \
+		OS_STATIC_GCD_STEP(Copy_Function,20,21) OS_STATIC_GCD_STEP(Copy_Function,21,22) OS_STATIC_GCD_STEP(Copy_Function,22,23) OS_STATIC_GCD_STEP(Copy_Function,23,24)
+
+#define OS_STATIC_LCM(Copy_Function,Copy_Periodicity)																			\
+		OS_STATIC_LCM_PREVIOUS_##Copy_Function,																				\
+		OS_STATIC_GCD_A_##Copy_Function##_0 = (Copy_Periodicity),															\
+		OS_STATIC_GCD_B_##Copy_Function##_0 = ((uint32_t)OS_STATIC_LCM_PREVIOUS_##Copy_Function - 1U) % (Copy_Periodicity),	\
+		OS_STATIC_GCD_STEPS(Copy_Function)																					\
+		OS_STATIC_LCM_##Copy_Function = (((uint32_t)OS_STATIC_LCM_PREVIOUS_##Copy_Function - 1U) /							\
+			OS_STATIC_GCD_A_##Copy_Function##_24) * (Copy_Periodicity),
+
+/* Check every listed period at compile time, before and after the hyperperiod fold */
+#define OS_STATIC_CHECK(Copy_Function,Copy_Periodicity)			_Static_assert((Copy_Periodicity) != 0, "Zero period of " #Copy_Function);
+
+#define OS_STATIC_CHECK_LCM(Copy_Function,Copy_Periodicity)		_Static_assert(OS_STATIC_GCD_B_##Copy_Function##_24 == 0,						\
+																			   "Period of " #Copy_Function " too large to fold into the hyperperiod");	\
+																_Static_assert((((uint32_t)OS_STATIC_LCM_PREVIOUS_##Copy_Function - 1U) /		\
+																				OS_STATIC_GCD_A_##Copy_Function##_24) <= (0xFFFFFFFFUL / (Copy_Periodicity)),	\
+																			   "Hyperperiod exceeds 32 bits with the period of " #Copy_Function);
+
+/* Priority of every listed task is its place in the list */
+#define OS_STATIC_PRIORITY(Copy_Function,Copy_Periodicity)		OS_STATIC_PRIORITY_##Copy_Function,
+
+#if OS_LOAD_ACCOUNTING == ENABLE
+
+	/* Release test and direct call of one listed task, its cycles charged to its priority */
+	#define OS_STATIC_DISPATCH(Copy_Function,Copy_Periodicity)	if((Local_PhaseCounter % (Copy_Periodicity)) == 0)						\
+																{																		\
+																	OS_LoadTaskStart(&Local_LoadState);									\
+																	Copy_Function();													\
+																	OS_LoadTaskStop(OS_STATIC_PRIORITY_##Copy_Function, &Local_LoadState);	\
+																}
+
+#else
+
+	/* Release test and direct call of one listed task */
+	#define OS_STATIC_DISPATCH(Copy_Function,Copy_Periodicity)	if((Local_PhaseCounter % (Copy_Periodicity)) == 0) { Copy_Function(); }
+
+#endif
+
+/* Least common multiple of all listed periods */
+#define OS_STATIC_HYPERPERIOD									((uint32_t)OS_STATIC_LCM_END - 1U)
+
+OS_STATIC_TASK_LIST(OS_STATIC_DECLARE)
+OS_STATIC_TASK_LIST(OS_STATIC_CHECK)
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                NEW TYPES DEFINITIONS                              */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+typedef enum
+{
+	OS_STATIC_LCM_START = 1,				/* Multiple of no period */
+	OS_STATIC_TASK_LIST(OS_STATIC_LCM)
+	OS_STATIC_LCM_END						/* Multiple of all listed periods, plus one */
+}OS_STATIC_LCM_t;
+
+typedef enum
+{
+	OS_STATIC_TASK_LIST(OS_STATIC_PRIORITY)
+	OS_STATIC_NUM_OF_TASKS					/* Number of listed tasks */
+}OS_STATIC_PRIORITY_t;
+
+OS_STATIC_TASK_LIST(OS_STATIC_CHECK_LCM)
+
+#if OS_LOAD_ACCOUNTING == ENABLE
+
+	_Static_assert(OS_STATIC_NUM_OF_TASKS <= NUM_OF_TASKS, "OS_LOAD_ACCOUNTING keeps the share of at most NUM_OF_TASKS listed tasks");
+
+#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+extern OS_Schedular_t Global_Schedular;	/* Its tick counter is kept counting so that OS_GetTickCount still works */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_StaticSchedular                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Unrolled tick pass of the static task set, called every OS     */
+/*                 tick instead of SCHEDULAR when OS_STATIC_TASK_SET is enabled   */
+/*--------------------------------------------------------------------------------*/
+void OS_StaticSchedular(void)
+{
+	/* Local Variables Definitions */
+	static uint32_t Local_HyperperiodPhase = 0;	 /* A variable to hold position of the current tick in the hyperperiod */
+	uint32_t Local_PhaseCounter;				 /* A variable to hold a non volatile copy of the phase */
+
+	#if OS_LOAD_ACCOUNTING == ENABLE
+
+		OS_LoadTaskState_t Local_LoadState;		 /* A variable to hold load accounting state of the task being run */
+
+	#endif
+
+	/* Increment System Tick Counter */
+	Global_Schedular.TickCounter++;
+
+	/* Phase 0 stands for the end of a hyperperiod, where every task is released like at tick == period */
+	Local_HyperperiodPhase++;
+
+	if(Local_HyperperiodPhase == OS_STATIC_HYPERPERIOD)
+	{
+		Local_HyperperiodPhase = 0;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	Local_PhaseCounter = Local_HyperperiodPhase;
+
+	/* Release test with a constant divisor and direct call of every task in priority order */
+	OS_STATIC_TASK_LIST(OS_STATIC_DISPATCH)
+}
+
+#endif
@@ -0,0 +1,266 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Topic                     */
+/*     			    Description	 : OS Topic Program File        */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Schedular.h"
+#include "OS_SeqLock.h"
+#include "OS_Topic.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+OS_Topic_t Global_TopicsArr[OS_NUM_OF_TOPICS];
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicCreate                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic in the topics table                  */
+/*                 Range: (0 --> OS_NUM_OF_TOPICS - 1)                            */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Size                                              */
+/*                 Brief: Size of the topic value in bytes                        */
+/*                 Range: (1 --> OS_TOPIC_MAX_SIZE)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Creates a topic with no subscribers and a zeroed value         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicCreate(uint8_t Copy_TopicId, uint8_t Copy_Size)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_ByteCounter;		/* A variable to hold count of cleared bytes */
+
+	/* Check if passed topic index and size are within valid range or not */
+	if(Copy_TopicId < OS_NUM_OF_TOPICS && Copy_Size != 0 && Copy_Size <= OS_TOPIC_MAX_SIZE)
+	{
+		/* Start from a stable seqlock and a zeroed value */
+		OS_SeqLockInit(&Global_TopicsArr[Copy_TopicId].Lock);
+
+		for(Local_ByteCounter = 0 ; Local_ByteCounter < OS_TOPIC_MAX_SIZE ; Local_ByteCounter++)
+		{
+			Global_TopicsArr[Copy_TopicId].Value[Local_ByteCounter] = 0;
+		}
+
+		/* No task is subscribed yet */
+		Global_TopicsArr[Copy_TopicId].SubscribersMask = 0;
+
+		/* Setting the size marks the topic as created */
+		Global_TopicsArr[Copy_TopicId].Size = Copy_Size;
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicSubscribe                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic to subscribe to                      */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_TaskPriority                                      */
+/*                 Brief: Priority of the task to be released on every publish    */
+/*                 Range: (0 --> NUM_OF_TASKS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Makes a task activated by an event pass right after each      */
+/*                 publish of the topic (tasks only reading the topic in their    */
+/*                 own period do not need to subscribe)                           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicSubscribe(uint8_t Copy_TopicId, uint8_t Copy_TaskPriority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed topic is created and passed priority belongs to a task in the system or not */
+	if(Copy_TopicId < OS_NUM_OF_TOPICS && Global_TopicsArr[Copy_TopicId].Size != 0 && Copy_TaskPriority < NUM_OF_TASKS)
+	{
+		/* Add the task to the topic subscribers */
+		OS_ATOMIC_SET_BITS(&Global_TopicsArr[Copy_TopicId].SubscribersMask, (1UL << Copy_TaskPriority));
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicPublish                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic to be published                      */
+/*                 -------------------------------------------------------------- */
+/*                 const void* Copy_pValue                                        */
+/*                 Brief: Pointer to the new value                                */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Size                                              */
+/*                 Brief: Size of the new value, must match the topic size        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Stores the new value of the topic, bumps its version and       */
+/*                 activates its subscribers, safe to be called from ISRs         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicPublish(uint8_t Copy_TopicId, const void* Copy_pValue, uint8_t Copy_Size)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_Subscribers;		/* A variable to hold subscribers still to be activated */
+	uint8_t Local_TaskPriority;		/* A variable to hold priority of the subscriber being activated */
+
+	/* Check if passed topic is created and passed size matches its size or not */
+	if(Copy_TopicId < OS_NUM_OF_TOPICS && Global_TopicsArr[Copy_TopicId].Size != 0 && Global_TopicsArr[Copy_TopicId].Size == Copy_Size)
+	{
+		/* Store the new value, readers never see it half written */
+		Local_Status = OS_SeqLockWrite(&Global_TopicsArr[Copy_TopicId].Lock, Global_TopicsArr[Copy_TopicId].Value, Copy_pValue, Copy_Size);
+
+		/* Activate every subscriber of the topic, they run in the event pass that follows */
+		Local_Subscribers = Global_TopicsArr[Copy_TopicId].SubscribersMask;
+
+		while(Local_Status == RT_OK && Local_Subscribers != 0)
+		{
+			Local_TaskPriority = (uint8_t)__builtin_ctzl(Local_Subscribers);
+			CLEAR_BIT(Local_Subscribers, Local_TaskPriority);
+			(void)OS_TaskActivate(Local_TaskPriority);
+		}
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicRead                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic to be read                           */
+/*                 -------------------------------------------------------------- */
+/*                 uint8_t Copy_Size                                              */
+/*                 Brief: Size of the value buffer, must match the topic size     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : void* Copy_pValue                                              */
+/*                 Brief: Pointer to where the latest value is copied             */
+/*                 -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pVersion                                        */
+/*                 Brief: Version of the copied value, 0 if never published       */
+/*                        (may be NULL)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Copies the latest value of the topic with its version          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicRead(uint8_t Copy_TopicId, void* Copy_pValue, uint8_t Copy_Size, uint32_t* Copy_pVersion)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed topic is created and passed size matches its size or not */
+	if(Copy_TopicId < OS_NUM_OF_TOPICS && Global_TopicsArr[Copy_TopicId].Size != 0 && Global_TopicsArr[Copy_TopicId].Size == Copy_Size)
+	{
+		/* Copy a consistent snapshot of the latest value */
+		Local_Status = OS_SeqLockRead(&Global_TopicsArr[Copy_TopicId].Lock, Global_TopicsArr[Copy_TopicId].Value, Copy_pValue, Copy_Size, Copy_pVersion);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TopicGetVersion                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint8_t Copy_TopicId                                           */
+/*                 Brief: Index of the topic                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : uint32_t* Copy_pVersion                                        */
+/*                 Brief: Number of publishes done on the topic so far            */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Gets the topic version without copying its value, so that a    */
+/*                 reader can skip values it already consumed                     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t OS_TopicGetVersion(uint8_t Copy_TopicId, uint32_t* Copy_pVersion)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pVersion != NULL)
+	{
+		/* Check if passed topic is created or not */
+		if(Copy_TopicId < OS_NUM_OF_TOPICS && Global_TopicsArr[Copy_TopicId].Size != 0)
+		{
+			/* Each completed publish adds 2 to the sequence, a publish in progress is not counted yet */
+			*Copy_pVersion = Global_TopicsArr[Copy_TopicId].Lock.Sequence >> 1;
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
@@ -0,0 +1,245 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 19, 2026                 */
+/*      			SWC          : OS Trace                     */
+/*     			    Description	 : OS Trace Program File        */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    LIBRARIES                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "OS_Config.h"
+#include "OS_Private.h"
+#include "OS_Trace.h"
+
+#if OS_FUNCTION_TRACE == ENABLE
+
+	#if OS_TRACE_NUM_OF_RECORDS < 2U || OS_TRACE_NUM_OF_RECORDS > 65536U || (OS_TRACE_NUM_OF_RECORDS & (OS_TRACE_NUM_OF_RECORDS - 1U)) != 0
+
+		#error " Wrong OS_TRACE_NUM_OF_RECORDS Configuration !"
+
+	#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             GLOBAL VARIABLES DEFINITION                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+OS_Trace_t Global_TraceData = {OS_FLASH_BASE_ADDRESS, OS_TRACE_NUM_OF_RECORDS, 0, {0}};	/* Ring buffer dumped by the debugger for Tools/trace_flamegraph.py */
+static volatile uint8_t Global_TraceRunning = ENABLE;		/* Records are only written while running */
+static uint32_t Global_TraceLastCycle = 0;				/* Cycle count of the previous record */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             PRIVATE FUNCTIONS PROTOTYPES                          */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void OS_TraceRecord(uint32_t Copy_Function) __attribute__((no_instrument_function));
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TraceStart                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Resumes recording, tracing is running from reset               */
+/*--------------------------------------------------------------------------------*/
+void OS_TraceStart(void)
+{
+	Global_TraceRunning = ENABLE;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TraceStop                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Freezes the ring buffer, so that the records leading to an     */
+/*                 event of interest are not overwritten before being dumped      */
+/*--------------------------------------------------------------------------------*/
+void OS_TraceStop(void)
+{
+	Global_TraceRunning = DISABLE;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TraceReset                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Discards every record, recording goes on if it was running     */
+/*--------------------------------------------------------------------------------*/
+void OS_TraceReset(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before the reset */
+
+	OS_ENTER_CRITICAL(Local_InterruptsState);
+
+	/* The decoder starts from the oldest record, which is record 0 again */
+	Global_TraceData.WriteCount = 0;
+
+	OS_EXIT_CRITICAL(Local_InterruptsState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: __cyg_profile_func_enter                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void* Copy_pFunction                                           */
+/*                 Brief: Address of the entered function                         */
+/*                 -------------------------------------------------------------- */
+/*                 void* Copy_pCallSite                                           */
+/*                 Brief: Return address of the call (not recorded)               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records a function entry, called by instrumented code only     */
+/*--------------------------------------------------------------------------------*/
+__attribute__((no_instrument_function)) void __cyg_profile_func_enter(void* Copy_pFunction, void* Copy_pCallSite)
+{
+	(void)Copy_pCallSite;
+
+	OS_TraceRecord(((uint32_t)Copy_pFunction & OS_TRACE_FUNCTION_MASK) | OS_TRACE_ENTRY);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: __cyg_profile_func_exit                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : void* Copy_pFunction                                           */
+/*                 Brief: Address of the returning function                       */
+/*                 -------------------------------------------------------------- */
+/*                 void* Copy_pCallSite                                           */
+/*                 Brief: Return address of the call (not recorded)               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Records a function exit, called by instrumented code only      */
+/*--------------------------------------------------------------------------------*/
+__attribute__((no_instrument_function)) void __cyg_profile_func_exit(void* Copy_pFunction, void* Copy_pCallSite)
+{
+	(void)Copy_pCallSite;
+
+	OS_TraceRecord((uint32_t)Copy_pFunction & OS_TRACE_FUNCTION_MASK);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                          PRIVATE FUNCTIONS IMPLEMENTATIONS                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OS_TraceRecord                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)    : uint32_t Copy_Function                                         */
+/*                 Brief: Function offset and entry flag of the record            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)   : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return       : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description  : Writes a record with the cycles elapsed since the previous     */
+/*                 one, preceded by long delta records if they do not fit         */
+/*--------------------------------------------------------------------------------*/
+__attribute__((no_instrument_function)) static void OS_TraceRecord(uint32_t Copy_Function)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_InterruptsState;		/* A variable to hold interrupts state before the record */
+	uint32_t Local_CycleCount;			/* A variable to hold cycle count of the record */
+	uint32_t Local_Delta;				/* A variable to hold cycles not yet carried by a record */
+	uint32_t Local_Chunk;				/* A variable to hold cycles / 4096 carried by a long delta record */
+
+	if(Global_TraceRunning == ENABLE)
+	{
+		/* Interrupts and preempting tasks may be traced too, keep records whole and in order */
+		OS_ENTER_CRITICAL(Local_InterruptsState);
+
+		/* Traced code may run before OS_Init started the cycle counter */
+		if(GET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA) == 0)
+		{
+			SET_BIT(DEMCR, DEMCR_TRCENA);
+			SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		Local_CycleCount = OS_CYCLE_COUNT();
+		Local_Delta = Local_CycleCount - Global_TraceLastCycle;
+		Global_TraceLastCycle = Local_CycleCount;
+
+		while(Local_Delta > OS_TRACE_DELTA_MAX)
+		{
+			Local_Chunk = Local_Delta >> OS_TRACE_LONG_DELTA_SHIFT;
+
+			if(Local_Chunk > OS_TRACE_DELTA_MAX)
+			{
+				Local_Chunk = OS_TRACE_DELTA_MAX;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+
+			Global_TraceData.RecordsArr[Global_TraceData.WriteCount & (OS_TRACE_NUM_OF_RECORDS - 1U)] = Local_Chunk << OS_TRACE_DELTA_SHIFT;
+			Global_TraceData.WriteCount++;
+			Local_Delta -= Local_Chunk << OS_TRACE_LONG_DELTA_SHIFT;
+		}
+
+		Global_TraceData.RecordsArr[Global_TraceData.WriteCount & (OS_TRACE_NUM_OF_RECORDS - 1U)] = (Local_Delta << OS_TRACE_DELTA_SHIFT) | Copy_Function;
+		Global_TraceData.WriteCount++;
+
+		OS_EXIT_CRITICAL(Local_InterruptsState);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+#elif OS_FUNCTION_TRACE != DISABLE
+
+	#error " Wrong OS_FUNCTION_TRACE Configuration !"
+
+#endif
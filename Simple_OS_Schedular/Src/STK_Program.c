@@ -40,6 +40,8 @@
 
 uint8_t Global_IntervalMode;						/* Global variable that holds interval mode whether it's single or periodic */
 void(*Global_CallbackFunction)(void) = NULL;		/* Global variable that holds pointer to function to be called once STK event is triggered */
+volatile uint32_t Global_EntryElapsedTime = 0;		/* Global variable that holds elapsed time captured at entry of the last SysTick exception */
+volatile uint32_t Global_EntryCycleCount = 0;		/* Global variable that holds cycle count captured at entry of the last SysTick exception */
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -382,6 +384,116 @@ ERROR_STATUS_t STK_GetRemainingTime(uint32_t* Copy_pRemainingTime)
 	return Local_Status;
 }
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetEntryElapsedTime          				                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pElapsedTime                                    */
+/*				   Brief: Pointer to uint32_t variable that will hold STK elapsed */
+/*				          time captured at entry of the last SysTick exception    */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets the elapsed time of SysTick timer captured by the last	  */
+/*				   SysTick exception handler before touching the timer, which is  */
+/*				   the exception latency (RT_NOK if STK_ENTRY_CAPTURE is          */
+/*				   disabled)                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetEntryElapsedTime(uint32_t* Copy_pElapsedTime)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pElapsedTime != NULL)
+	{
+		#if STK_ENTRY_CAPTURE == ENABLE
+
+			/* Elapsed time captured by the last SysTick exception handler */
+			*Copy_pElapsedTime = Global_EntryElapsedTime;
+
+		#elif STK_ENTRY_CAPTURE == DISABLE
+
+			/* Nothing is captured */
+			Local_Status = RT_NOK;
+
+		#else
+
+			#error " Wrong SysTick Entry Capture Configuration !"
+
+		#endif
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetEntryCycles          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pExpiryCycle                                    */
+/*				   Brief: Pointer to uint32_t variable that will hold cycle count */
+/*				          (DWT CYCCNT) at which the SysTick timer expired         */
+/*				   Range: None                                                    */
+/*  			   -------------------------------------------------------------- */
+/*				   uint32_t* Copy_pEntryCycle                                     */
+/*				   Brief: Pointer to uint32_t variable that will hold cycle count */
+/*				          (DWT CYCCNT) at entry of the SysTick exception handler  */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets the cycle counts of the expiry served by the last SysTick */
+/*				   exception and of its handler entry, rebuilt from the cycle     */
+/*				   count and elapsed time the handler captured before touching    */
+/*				   the timer (RT_NOK if STK_ENTRY_CAPTURE is disabled)            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetEntryCycles(uint32_t* Copy_pExpiryCycle, uint32_t* Copy_pEntryCycle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointers are NULL or not */
+	if(Copy_pExpiryCycle != NULL && Copy_pEntryCycle != NULL)
+	{
+		#if STK_ENTRY_CAPTURE == ENABLE
+
+			/* The exception is raised on the count before the reload, one SysTick count is STK_COUNT_CYCLES cycles */
+			*Copy_pEntryCycle = Global_EntryCycleCount;
+			*Copy_pExpiryCycle = Global_EntryCycleCount - ((Global_EntryElapsedTime + 1U) * STK_COUNT_CYCLES);
+
+		#elif STK_ENTRY_CAPTURE == DISABLE
+
+			/* Nothing is captured */
+			Local_Status = RT_NOK;
+
+		#else
+
+			#error " Wrong SysTick Entry Capture Configuration !"
+
+		#endif
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                            	  INTERRUPT HANDLERS		                    	 */
@@ -395,6 +507,16 @@ ERROR_STATUS_t STK_GetRemainingTime(uint32_t* Copy_pRemainingTime)
 /*--------------------------------------------------------------------------------*/
 void SysTick_Handler(void)
 {
+#if STK_ENTRY_CAPTURE == ENABLE
+	/* Local Variables Definitions */
+	uint32_t Local_Cycle = STK_DWT_CYCCNT;	/* Read the cycle count first, it is the entry instant */
+	uint32_t Local_Value = STK->VAL;		/* Read VAL next, it is the one moving */
+
+	/* Capture entry instant and elapsed time since reload before the timer is touched */
+	Global_EntryCycleCount = Local_Cycle;
+	Global_EntryElapsedTime = STK->LOAD - Local_Value;
+
+#endif
 	/* Check source of SysTick exception handler */
 	if(Global_IntervalMode == STK_SINGLE_INTERVAL)
 	{
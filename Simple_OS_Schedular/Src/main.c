@@ -26,15 +26,17 @@
 #include "GPIO_Interface.h"
 
 #include "OS_Schedular.h"
+#include "OS_Idle.h"
+#include "OS_Stack.h"
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                                  TASKS PROTOTYPES		  		                 */
 /*                                                                                   */
 /*-----------------------------------------------------------------------------------*/
-void RED_LED_TASK(void);
-void YELLOW_LED_TASK(void);
-void GREEN_LED_TASK(void);
+DEFINE_TASK(RED_LED_TASK    , 0, 1, 0);	/* Task1 Registration */
+DEFINE_TASK(YELLOW_LED_TASK , 1, 2, 0);	/* Task2 Registration */
+DEFINE_TASK(GREEN_LED_TASK  , 2, 5, 0);	/* Task3 Registration */
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -55,17 +57,17 @@ void main()
 	/* Initialize GPIO pins to which red, yellow and green LEDs are connected */
 	GPIO_Init();
 
-	/* Register tasks to OS */
-	TASKS_CREATION(0, 1 , RED_LED_TASK);	/* Task1 Registration */
-	TASKS_CREATION(1, 2 , YELLOW_LED_TASK);	/* Task2 Registration */
-	TASKS_CREATION(2, 5 , GREEN_LED_TASK);	/* Task3 Registration */
+	/* Register background jobs run in CPU idle time */
+	OS_IdleJobCreate(0, OS_IdleFlashChecksumJob);
+	OS_IdleJobCreate(1, OS_StackScanJob);
 
 	/* Initialize OS */
 	OS_Init();
 
 	while(1)
 	{
-
+		/* Run background jobs between ticks */
+		OS_IdleRun();
 	}
 }
 
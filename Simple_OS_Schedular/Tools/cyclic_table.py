@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""Generate the major/minor frame table of the OS cyclic executive.
+
+Usage: cyclic_table.py <task set file> <output header>
+
+The task set file lists one task per line as "<priority> <function> <period us>
+<WCET us>" ('#' starts a comment). Every deadline is taken equal to the period.
+
+The major frame is the hyperperiod (LCM of the periods). The minor frame is the
+largest divisor f of the major frame that satisfies the classic frame
+constraints:
+
+  (1) f >= every WCET, so a job never needs to be split over frames,
+  (2) f divides the major frame,
+  (3) 2f - gcd(period, f) <= period for every task, so there is a whole frame
+      between the release and the deadline of every job,
+
+and for which every job fits a frame inside its release/deadline window
+(jobs are placed earliest deadline first in the earliest frame with room).
+
+The minor frame becomes the SysTick period, Src/OS_Cyclic.c fails the build if
+its reload does not fit the 24-bit SysTick counter at the configured clock.
+"""
+
+import math
+import sys
+
+# The frame index of the cyclic executive is 16-bit
+MAX_NUM_OF_FRAMES = 65535
+
+
+def parse_task_set(path):
+    tasks = []
+    with open(path) as f:
+        for line_no, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            fields = line.split()
+            if len(fields) != 4:
+                sys.exit('%s:%d: expected "<priority> <function> <period us> <WCET us>"' % (path, line_no))
+            priority, name, period, wcet = int(fields[0]), fields[1], int(fields[2]), int(fields[3])
+            if not 0 <= priority < 32 or period <= 0 or not 0 < wcet <= period:
+                sys.exit('%s:%d: invalid task %s' % (path, line_no, name))
+            tasks.append({'priority': priority, 'name': name, 'period': period, 'wcet': wcet})
+    if not tasks:
+        sys.exit('%s: empty task set' % path)
+    if len({t['priority'] for t in tasks}) != len(tasks):
+        sys.exit('%s: two tasks share the same priority' % path)
+    return tasks
+
+
+def divisors(n):
+    """Divisors of n in decreasing order, paired up to sqrt(n)."""
+    small, large = [], []
+    for d in range(1, math.isqrt(n) + 1):
+        if n % d == 0:
+            small.append(d)
+            if d != n // d:
+                large.append(n // d)
+    return large + small[::-1]
+
+
+def frame_candidates(tasks, major):
+    max_wcet = max(t['wcet'] for t in tasks)
+    for f in divisors(major):
+        if f < max_wcet:
+            break
+        if all(2 * f - math.gcd(t['period'], f) <= t['period'] for t in tasks):
+            yield f
+
+
+def place_jobs(tasks, major, minor):
+    num_of_frames = major // minor
+    if num_of_frames > MAX_NUM_OF_FRAMES:
+        return None
+    slack = [minor] * num_of_frames
+    frames = [[] for _ in range(num_of_frames)]
+    jobs = []
+    for t in tasks:
+        for release in range(0, major, t['period']):
+            jobs.append((release + t['period'], release, t))
+    for deadline, release, t in sorted(jobs, key=lambda j: (j[0], j[2]['priority'])):
+        first = -(-release // minor)
+        last = deadline // minor
+        for frame in range(first, last):
+            if slack[frame] >= t['wcet']:
+                slack[frame] -= t['wcet']
+                frames[frame].append(t)
+                break
+        else:
+            return None
+    return frames, slack
+
+
+def write_header(path, tasks, major, minor, frames, slack):
+    utilization = sum(t['wcet'] / t['period'] for t in tasks)
+    out = []
+    out.append('/' + '*' * 64 + '/')
+    out.append('/*' + '  SWC          : OS Cyclic'.ljust(62) + '*/')
+    out.append('/*' + '  Description  : OS Cyclic Frame Table'.ljust(62) + '*/')
+    out.append('/*' + '  Generated by Tools/cyclic_table.py, do not edit'.ljust(62) + '*/')
+    out.append('/' + '*' * 64 + '/')
+    out.append('')
+    out.append('#ifndef OS_CYCLICTABLE_H_')
+    out.append('#define OS_CYCLICTABLE_H_')
+    out.append('')
+    out.append('/*')
+    out.append(' * Task set (utilization %.4f):' % utilization)
+    for t in sorted(tasks, key=lambda t: t['priority']):
+        out.append(' *   %2d  %-24s period %10d us  WCET %8d us' % (t['priority'], t['name'], t['period'], t['wcet']))
+    out.append(' *')
+    out.append(' * Major frame %d us, minor frame %d us' % (major, minor))
+    out.append(' */')
+    out.append('')
+    out.append('/* Length of a minor frame in microseconds (SysTick period) */')
+    out.append('#define OS_CYCLIC_MINOR_FRAME_US\t\t%dUL' % minor)
+    out.append('')
+    out.append('/* Number of minor frames in the major frame */')
+    out.append('#define OS_CYCLIC_NUM_OF_FRAMES\t\t\t%dU' % len(frames))
+    out.append('')
+    out.append('/* One mask of the tasks run in every minor frame (bit number = task priority) */')
+    out.append('#define OS_CYCLIC_FRAME_TABLE\t\t\t\t\t\t\t\t\t\t\t\\')
+    out.append('\t\t{\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\\')
+    for i, frame in enumerate(frames):
+        mask = 0
+        for t in frame:
+            mask |= 1 << t['priority']
+        names = ', '.join(t['name'] for t in sorted(frame, key=lambda t: t['priority'])) or 'idle'
+        sep = ',' if i + 1 < len(frames) else ' '
+        out.append('\t\t\t0x%08XUL%s\t/* Frame %3d, slack %8d us : %s */\t\\' % (mask, sep, i, slack[i], names))
+    out.append('\t\t}')
+    out.append('')
+    out.append('#endif /* OS_CYCLICTABLE_H_ */')
+    with open(path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    tasks = parse_task_set(sys.argv[1])
+    major = 1
+    for t in tasks:
+        major = major * t['period'] // math.gcd(major, t['period'])
+    for minor in frame_candidates(tasks, major):
+        placement = place_jobs(tasks, major, minor)
+        if placement is not None:
+            write_header(sys.argv[2], tasks, major, minor, *placement)
+            return
+    sys.exit('no feasible minor frame for this task set with at most %d frames' % MAX_NUM_OF_FRAMES)
+
+
+if __name__ == '__main__':
+    main()
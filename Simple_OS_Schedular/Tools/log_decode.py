@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Format the records of the OS binary log on the host.
+
+Usage: log_decode.py [--stream] <elf> <log file>
+
+The log file is either the raw content of Global_LogData read from the target,
+for example with gdb:
+
+  dump binary value log.bin Global_LogData
+
+which starts with the number of words of the ring buffer, the counts of words
+written and read so far and the count of dropped records, or with --stream the
+words moved out by OS_LogRead and sent to the host, all little endian.
+
+Every record is a header word (format string ID in bits 31:16, number of
+arguments in bits 7:0), the CPU cycle count of the call, then the arguments.
+The ID is the offset of "<level>\\x1f<file>\\x1f<line>\\x1f<format>" in the
+.os_log_strings section of the image, read with arm-none-eabi-objdump (or
+$OBJDUMP). Every output line is "<cycles> <+delta> <level> <file>:<line> <text>".
+"""
+
+import binascii
+import os
+import re
+import struct
+import subprocess
+import sys
+
+DUMP_HEADER_FORMAT = '<4I'
+ID_SHIFT = 16
+NUM_OF_ARGS_MASK = 0x000000FF
+RECORD_HEADER_WORDS = 2
+SECTION = '.os_log_strings'
+SEPARATOR = '\x1f'
+CONVERSION = re.compile(r'%([-+ #0]*)(\d*)(\.\d+)?(?:hh|h|ll|l|j|z|t)?([diuxXocp%])')
+
+
+def read_strings(elf):
+    tool = os.environ.get('OBJDUMP', 'arm-none-eabi-objdump')
+    try:
+        output = subprocess.run([tool, '-s', '-j', SECTION, elf], check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit('%s failed: %s' % (tool, error))
+    data = bytearray()
+    start = None
+    for line in output.splitlines():
+        fields = line.split()
+        if not line.startswith(' ') or not fields or not re.fullmatch(r'[0-9a-f]+', fields[0]):
+            continue
+        if start is None:
+            start = int(fields[0], 16)
+        # The four groups of hex bytes come before the ASCII column
+        column = line.index(fields[0]) + len(fields[0]) + 1
+        data += binascii.unhexlify(line[column:column + 36].replace(' ', ''))
+    if start is None:
+        sys.exit('%s: no %s section, is OS_BINARY_LOG enabled?' % (elf, SECTION))
+    return start, bytes(data)
+
+
+def format_string(strings, string_id):
+    start, data = strings
+    offset = string_id - start
+    if offset < 0 or offset >= len(data):
+        return None
+    end = data.find(b'\0', offset)
+    fields = data[offset:end if end >= 0 else len(data)].decode('latin-1').split(SEPARATOR, 3)
+    return fields if len(fields) == 4 else None
+
+
+def printf(fmt, args):
+    args = list(args)
+
+    def convert(match):
+        flags, width, precision, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        if not args:
+            return match.group(0)
+        value = args.pop(0)
+        if conversion in 'di':
+            value -= (value & 0x80000000) << 1
+        elif conversion == 'c':
+            return ('%' + flags.replace('0', '') + width + 's') % chr(value & 0xFF)
+        elif conversion == 'p':
+            return ('%' + flags + width + 's') % ('0x%08x' % value)
+        return ('%' + flags + width + (precision or '') + conversion.replace('u', 'd').replace('i', 'd')) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def read_words(path, stream):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if stream:
+        return list(struct.unpack_from('<%dI' % (len(data) // 4), data)), 0
+    header_size = struct.calcsize(DUMP_HEADER_FORMAT)
+    if len(data) < header_size:
+        sys.exit('%s: too short for a log' % path)
+    num_of_words, write_count, read_count, dropped = struct.unpack_from(DUMP_HEADER_FORMAT, data)
+    if not num_of_words or len(data) < header_size + 4 * num_of_words or (write_count - read_count) & 0xFFFFFFFF > num_of_words:
+        sys.exit('%s: not a Global_LogData dump' % path)
+    ring = struct.unpack_from('<%dI' % num_of_words, data, header_size)
+    count = (write_count - read_count) & 0xFFFFFFFF
+    return [ring[(read_count + index) % num_of_words] for index in range(count)], dropped
+
+
+def decode(strings, words):
+    lines = []
+    previous = None
+    index = 0
+    while index + RECORD_HEADER_WORDS <= len(words):
+        header, cycles = words[index:index + RECORD_HEADER_WORDS]
+        num_of_args = header & NUM_OF_ARGS_MASK
+        args = words[index + RECORD_HEADER_WORDS:index + RECORD_HEADER_WORDS + num_of_args]
+        index += RECORD_HEADER_WORDS + num_of_args
+        delta = 0 if previous is None else (cycles - previous) & 0xFFFFFFFF
+        previous = cycles
+        fields = format_string(strings, header >> ID_SHIFT)
+        if fields is None or len(args) != num_of_args:
+            lines.append('%10u +%-10u ? unknown record 0x%08X, image and log do not match\n' % (cycles, delta, header))
+            continue
+        level, source, line, fmt = fields
+        lines.append('%10u +%-10u %s %s:%s %s\n' % (cycles, delta, level, source, line, printf(fmt, args)))
+    if index != len(words):
+        lines.append('truncated record at the end of the log\n')
+    return lines
+
+
+def main():
+    arguments = sys.argv[1:]
+    stream = '--stream' in arguments
+    if stream:
+        arguments.remove('--stream')
+    if len(arguments) != 2:
+        sys.exit(__doc__.strip().splitlines()[2])
+    words, dropped = read_words(arguments[1], stream)
+    lines = decode(read_strings(arguments[0]), words)
+    if dropped:
+        lines.append('%u records dropped while the log was full\n' % dropped)
+    sys.stdout.writelines(lines)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Print the flat per-function profile taken by the OS sampling profiler.
+
+Usage: profile_report.py <elf> <profile dump> [<number of functions>]
+
+The profile dump is the raw content of Global_ProfilerData read from the target,
+for example with gdb:
+
+  dump binary value profile.bin Global_ProfilerData
+
+It starts with the bucket description written by OS_ProfilerInit (base address,
+bucket shift, number of buckets) followed by the samples count, the out of range
+count and the 16-bit count of every bucket, all little endian.
+
+Functions come from the symbol table of the image (arm-none-eabi-nm, or $NM).
+A bucket overlapping several functions is shared between them in proportion of
+the bytes of the bucket each one covers, so small buckets give sharper results.
+"""
+
+import os
+import struct
+import subprocess
+import sys
+
+HEADER_FORMAT = '<5I'
+FUNCTION_TYPES = 'tTwW'
+
+
+def read_profile(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    header_size = struct.calcsize(HEADER_FORMAT)
+    if len(data) < header_size:
+        sys.exit('%s: too short for a profile' % path)
+    base, shift, num_of_buckets, samples, out_of_range = struct.unpack_from(HEADER_FORMAT, data)
+    if not 0 < shift < 32 or len(data) < header_size + 2 * num_of_buckets:
+        sys.exit('%s: not a Global_ProfilerData dump (was OS_ProfilerInit called?)' % path)
+    buckets = struct.unpack_from('<%dH' % num_of_buckets, data, header_size)
+    return base, shift, buckets, samples, out_of_range
+
+
+def read_functions(elf):
+    tool = os.environ.get('NM', 'arm-none-eabi-nm')
+    try:
+        output = subprocess.run([tool, '-S', '-n', '--defined-only', elf], check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit('%s failed: %s' % (tool, error))
+    functions = {}
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) != 4 or fields[2] not in FUNCTION_TYPES:
+            continue
+        # Thumb function symbols have bit 0 set
+        start = int(fields[0], 16) & ~1
+        size = int(fields[1], 16)
+        if size:
+            functions[start] = (start + size, fields[3])
+    return sorted((start, end, name) for start, (end, name) in functions.items())
+
+
+def attribute(base, shift, buckets, functions):
+    profile = {}
+    unknown = 0.0
+    index = 0
+    for bucket, count in enumerate(buckets):
+        if not count:
+            continue
+        low = base + (bucket << shift)
+        high = low + (1 << shift)
+        while index < len(functions) and functions[index][1] <= low:
+            index += 1
+        covered = 0
+        current = index
+        while current < len(functions) and functions[current][0] < high:
+            start, end, name = functions[current]
+            overlap = min(end, high) - max(start, low)
+            profile[name] = profile.get(name, 0.0) + count * overlap / (high - low)
+            covered += overlap
+            current += 1
+        unknown += count * (high - low - covered) / (high - low)
+    return profile, unknown
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        sys.exit(__doc__.strip().splitlines()[2])
+    base, shift, buckets, samples, out_of_range = read_profile(sys.argv[2])
+    limit = int(sys.argv[3]) if len(sys.argv) == 4 else None
+    profile, unknown = attribute(base, shift, buckets, read_functions(sys.argv[1]))
+
+    if not samples:
+        sys.exit('No samples taken')
+    if 0xFFFF in buckets:
+        print('Sampling stopped by a full bucket, the profile covers the start of the run only')
+    print('%d samples, %d-byte buckets from 0x%08X' % (samples, 1 << shift, base))
+    print()
+    print('%8s %9s  %s' % ('share', 'samples', 'function'))
+    rows = sorted(profile.items(), key=lambda item: -item[1])[:limit]
+    for name, count in rows:
+        print('%7.2f%% %9.1f  %s' % (100.0 * count / samples, count, name))
+    if unknown:
+        print('%7.2f%% %9.1f  %s' % (100.0 * unknown / samples, unknown, '<no symbol>'))
+    if out_of_range:
+        print('%7.2f%% %9d  %s' % (100.0 * out_of_range / samples, out_of_range, '<out of buckets range>'))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,278 @@
+#!/usr/bin/env python3
+"""Compute the worst-case stack depth of every task and interrupt handler.
+
+Usage: stack_budget.py <elf> <.su directory> <calls file> <output header> [<linker script>]
+
+Frame sizes come from the .su files written by -fstack-usage, the call graph
+from the disassembly of the image (arm-none-eabi-objdump, or $OBJDUMP). Calls
+through pointers are invisible in the disassembly and are taken from the calls
+file, which also gives frame sizes of functions without a .su entry (assembly,
+libraries), extra task entry points and the preemption levels of the handlers.
+
+The depth of a function is its own frame plus the deepest of its callees. Roots
+are:
+
+  - every task entry point (DEFINE_TASK descriptors of .os_tasks and the
+    "task" lines of the calls file), its own call tree only,
+  - every implemented exception handler, its call tree plus the exception
+    frame the core stacks on entry,
+  - thread mode, the call tree of Reset_Handler (main and the idle loop).
+
+All of them share the main stack. Handlers of one preemption level never nest
+each other, handlers not listed on a "level" line are taken as a level of their
+own, so the main stack budget is the thread mode depth plus the deepest handler
+of every level.
+"""
+
+import glob
+import os
+import re
+import subprocess
+import sys
+
+# Basic exception frame (8 words) plus the word the core may add to keep the stack 8-byte aligned
+EXCEPTION_FRAME_BYTES = 36
+
+# Size of an OS_TaskDescriptor_t placed in .os_tasks by DEFINE_TASK
+TASK_DESCRIPTOR_BYTES = 8
+
+FUNCTION_RE = re.compile(r'^([0-9a-f]+) <([^>]+)>:$')
+INSTRUCTION_RE = re.compile(r'^\s*([0-9a-f]+):\s+([a-z][a-z0-9.]*)\s*(.*)$')
+TARGET_RE = re.compile(r'<([^>+]+)>')
+SYMBOL_RE = re.compile(r'^([0-9a-f]+)\s.*\sF\s+\S+\s+[0-9a-f]+\s+(\S+)$')
+
+
+def objdump(elf, *args):
+    tool = os.environ.get('OBJDUMP', 'arm-none-eabi-objdump')
+    try:
+        return subprocess.run([tool] + list(args) + [elf], check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit('%s failed: %s' % (tool, error))
+
+
+def parse_stack_usage(directory):
+    frames = {}
+    dynamic = set()
+    for path in glob.glob(os.path.join(directory, '**', '*.su'), recursive=True):
+        with open(path) as f:
+            for line_no, line in enumerate(f, 1):
+                fields = line.rstrip('\n').split('\t')
+                if len(fields) != 3:
+                    sys.exit('%s:%d: expected "<location>:<function>\\t<bytes>\\t<qualifiers>"' % (path, line_no))
+                name = fields[0].rsplit(':', 1)[-1]
+                frames[name] = max(frames.get(name, 0), int(fields[1]))
+                if 'dynamic' in fields[2]:
+                    dynamic.add(name)
+    if not frames:
+        sys.exit('%s: no .su file, build with -fstack-usage' % directory)
+    return frames, dynamic
+
+
+def parse_calls_file(path):
+    config = {'edges': {}, 'frames': {}, 'tasks': [], 'levels': []}
+    with open(path) as f:
+        for line_no, line in enumerate(f, 1):
+            fields = line.split('#', 1)[0].split()
+            if not fields:
+                continue
+            if fields[0] == 'frame' and len(fields) == 3:
+                config['frames'][fields[1]] = int(fields[2])
+            elif fields[0] == 'task' and len(fields) >= 2:
+                config['tasks'].extend(fields[1:])
+            elif fields[0] == 'level' and len(fields) >= 3:
+                config['levels'].append(fields[2:])
+            elif len(fields) >= 2 and fields[0] not in ('frame', 'task', 'level'):
+                config['edges'].setdefault(fields[0], []).extend(fields[1:])
+            else:
+                sys.exit('%s:%d: unknown line' % (path, line_no))
+    return config
+
+
+def parse_call_graph(disassembly):
+    calls = {}
+    indirect = set()
+    function = None
+    for line in disassembly.splitlines():
+        match = FUNCTION_RE.match(line)
+        if match:
+            function = match.group(2)
+            calls.setdefault(function, set())
+            continue
+        match = INSTRUCTION_RE.match(line)
+        if not match or function is None:
+            continue
+        mnemonic, operands = match.group(2).split('.')[0], match.group(3)
+        target = TARGET_RE.search(operands)
+        if mnemonic in ('bl', 'blx') and target:
+            calls[function].add(target.group(1))
+        elif mnemonic == 'blx' or (mnemonic == 'bx' and not operands.startswith('lr')):
+            indirect.add(function)
+        elif re.fullmatch(r'b(eq|ne|cs|hs|cc|lo|mi|pl|vs|vc|hi|ls|ge|lt|gt|le|al)?', mnemonic) and target \
+                and target.group(1) != function:
+            # Branch to the start of another function, a tail call
+            calls[function].add(target.group(1))
+    return calls, indirect
+
+
+def parse_symbols(table):
+    by_address = {}
+    for line in table.splitlines():
+        match = SYMBOL_RE.match(line)
+        if match:
+            by_address.setdefault(int(match.group(1), 16) & ~1, []).append(match.group(2))
+    return by_address
+
+
+def parse_task_descriptors(dump, by_address):
+    data = bytearray()
+    for line in dump.splitlines():
+        fields = line.split()
+        if len(fields) >= 2 and re.fullmatch(r'[0-9a-f]+', fields[0]) and re.fullmatch(r'[0-9a-f]{2,8}', fields[1]):
+            for word in fields[1:5]:
+                if not re.fullmatch(r'[0-9a-f]{2,8}', word):
+                    break
+                data += bytes.fromhex(word)
+    tasks = []
+    for offset in range(0, len(data) - TASK_DESCRIPTOR_BYTES + 1, TASK_DESCRIPTOR_BYTES):
+        address = int.from_bytes(data[offset:offset + 4], 'little') & ~1
+        names = by_address.get(address)
+        if not names:
+            sys.exit('.os_tasks: no function at 0x%08x' % address)
+        tasks.append(names[0])
+    return tasks
+
+
+class StackGraph:
+    def __init__(self, frames, calls, edges, tasks):
+        self.frames = frames
+        self.calls = calls
+        self.edges = edges
+        self.tasks = tasks
+        self.depths = {}
+        self.unknown = set()
+        self.recursive = set()
+
+    def callees(self, function):
+        result = set(self.calls.get(function, ()))
+        for callee in self.edges.get(function, ()):
+            result.update(self.tasks if callee == '@tasks' else [callee])
+        return result
+
+    def depth(self, function, path=()):
+        if function in self.depths:
+            return self.depths[function]
+        if function in path:
+            self.recursive.add(function)
+            return 0
+        if function not in self.frames:
+            self.unknown.add(function)
+        deepest = 0
+        for callee in sorted(self.callees(function)):
+            deepest = max(deepest, self.depth(callee, path + (function,)))
+        self.depths[function] = self.frames.get(function, 0) + deepest
+        return self.depths[function]
+
+
+def linker_stack_size(path):
+    with open(path) as f:
+        match = re.search(r'_Min_Stack_Size\s*=\s*(0x[0-9a-fA-F]+|\d+)', f.read())
+    return int(match.group(1), 0) if match else None
+
+
+def macro_name(function):
+    return re.sub(r'[^A-Za-z0-9]', '_', function).upper()
+
+
+def write_header(path, elf, task_depths, handler_depths, thread_depth, levels, total, notes):
+    out = []
+    out.append('/' + '*' * 64 + '/')
+    out.append('/*' + '  SWC          : OS Stack'.ljust(62) + '*/')
+    out.append('/*' + '  Description  : OS Stack Budget'.ljust(62) + '*/')
+    out.append('/*' + '  Generated by Tools/stack_budget.py, do not edit'.ljust(62) + '*/')
+    out.append('/' + '*' * 64 + '/')
+    out.append('')
+    out.append('#ifndef OS_STACKBUDGET_H_')
+    out.append('#define OS_STACKBUDGET_H_')
+    out.append('')
+    out.append('/*')
+    out.append(' * Worst-case stack depths in bytes computed from %s' % os.path.basename(elf))
+    out.append(' *')
+    for level, handlers in enumerate(levels):
+        out.append(' * Preemption level %d: %s' % (level, ', '.join(handlers)))
+    for note in notes:
+        out.append(' * ' + note)
+    out.append(' */')
+    out.append('')
+    out.append('/* Call tree of every task entry point */')
+    for task in sorted(task_depths):
+        out.append('#define OS_STACK_BUDGET_TASK_%s\t\t%dU' % (macro_name(task), task_depths[task]))
+    out.append('')
+    out.append('/* Call tree of every exception handler with its exception frame */')
+    for handler in sorted(handler_depths):
+        out.append('#define OS_STACK_BUDGET_ISR_%s\t\t%dU' % (macro_name(handler), handler_depths[handler]))
+    out.append('')
+    out.append('/* Thread mode (main and the idle loop) */')
+    out.append('#define OS_STACK_BUDGET_THREAD\t\t\t%dU' % thread_depth)
+    out.append('')
+    out.append('/* Main stack with the deepest handler of every preemption level nested over thread mode */')
+    out.append('#define OS_STACK_BUDGET_MAIN_STACK\t\t%dU' % total)
+    out.append('')
+    out.append('#endif /* OS_STACKBUDGET_H_ */')
+    with open(path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+def main():
+    if len(sys.argv) not in (5, 6):
+        sys.exit(__doc__)
+    elf, su_directory, calls_path, header_path = sys.argv[1:5]
+
+    frames, dynamic = parse_stack_usage(su_directory)
+    config = parse_calls_file(calls_path)
+    frames.update(config['frames'])
+    calls, indirect = parse_call_graph(objdump(elf, '-d', '--no-show-raw-insn'))
+    by_address = parse_symbols(objdump(elf, '-t'))
+    has_tasks_section = '.os_tasks' in objdump(elf, '-h')
+    tasks = parse_task_descriptors(objdump(elf, '-s', '-j', '.os_tasks'), by_address) if has_tasks_section else []
+    tasks = sorted(set(tasks + config['tasks']))
+
+    graph = StackGraph(frames, calls, config['edges'], tasks)
+    task_depths = {task: graph.depth(task) for task in tasks}
+
+    # Handlers left on the default handler (weak aliases) share its address and are skipped
+    default = [address for address, names in by_address.items() if 'Default_Handler' in names]
+    handlers = sorted({name for address, names in by_address.items() if address not in default
+                       for name in names if name.endswith('Handler') and name != 'Reset_Handler'})
+    handler_depths = {handler: graph.depth(handler) + EXCEPTION_FRAME_BYTES for handler in handlers}
+    thread_depth = graph.depth('Reset_Handler' if 'Reset_Handler' in calls else 'main')
+
+    levels = [[h for h in level if h in handler_depths] for level in config['levels']]
+    listed = {h for level in levels for h in level}
+    levels = [level for level in levels if level] + [[h] for h in handlers if h not in listed]
+    total = thread_depth + sum(max(handler_depths[h] for h in level) for level in levels)
+
+    notes = []
+    unresolved = sorted(f for f in indirect if f not in config['edges'] and f in graph.depths)
+    if unresolved:
+        notes.append('Calls through pointers not in the calls file (callees not counted): ' + ', '.join(unresolved))
+    if graph.unknown:
+        notes.append('No frame size (counted as 0): ' + ', '.join(sorted(graph.unknown)))
+    if graph.recursive:
+        notes.append('Recursion (one call counted): ' + ', '.join(sorted(graph.recursive)))
+    dynamic_used = sorted(dynamic & set(graph.depths))
+    if dynamic_used:
+        notes.append('Dynamic frames (alloca/VLA, size is a lower bound): ' + ', '.join(dynamic_used))
+
+    write_header(header_path, elf, task_depths, handler_depths, thread_depth, levels, total, notes)
+
+    print('Main stack worst case: %d bytes (thread mode %d, %d preemption levels)' % (total, thread_depth, len(levels)))
+    for note in notes:
+        print('warning: ' + note)
+    if len(sys.argv) == 6:
+        reserved = linker_stack_size(sys.argv[5])
+        if reserved is not None and reserved < total:
+            print('warning: _Min_Stack_Size (%d bytes) is below the worst case' % reserved)
+
+
+if __name__ == '__main__':
+    main()
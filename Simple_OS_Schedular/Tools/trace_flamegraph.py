@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Turn the OS function trace into folded call stacks for a flame graph.
+
+Usage: trace_flamegraph.py <elf> <trace dump> [<output file>]
+
+The trace dump is the raw content of Global_TraceData read from the target,
+for example with gdb:
+
+  dump binary value trace.bin Global_TraceData
+
+It starts with the base address, the number of records and the count of records
+written so far, followed by the ring buffer of 32-bit records, all little endian:
+
+  bit 0       set on function entry, cleared on exit
+  bits 19:1   function address offset from the base address
+  bits 31:20  CPU cycles since the previous record
+
+Records with bits 19:0 cleared only carry cycles / 4096 that add to the delta
+of the next record.
+
+Every output line is "<outermost>;...;<innermost> <cycles>", the cycles spent in
+the innermost function itself with that call stack (the folded format read by
+flamegraph.pl and speedscope). Function names come from the symbol table of the
+image (arm-none-eabi-nm, or $NM). Once the ring buffer wrapped, the oldest
+records are lost, exits of functions entered before them are skipped.
+"""
+
+import os
+import struct
+import subprocess
+import sys
+
+HEADER_FORMAT = '<3I'
+ENTRY = 0x00000001
+FUNCTION_MASK = 0x000FFFFE
+DELTA_SHIFT = 20
+LONG_DELTA_SHIFT = 12
+
+
+def read_trace(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    header_size = struct.calcsize(HEADER_FORMAT)
+    if len(data) < header_size:
+        sys.exit('%s: too short for a trace' % path)
+    base, num_of_records, write_count = struct.unpack_from(HEADER_FORMAT, data)
+    if not num_of_records or len(data) < header_size + 4 * num_of_records:
+        sys.exit('%s: not a Global_TraceData dump' % path)
+    ring = struct.unpack_from('<%dI' % num_of_records, data, header_size)
+    if write_count <= num_of_records:
+        return base, list(ring[:write_count])
+    oldest = write_count % num_of_records
+    return base, list(ring[oldest:] + ring[:oldest])
+
+
+def read_functions(elf):
+    tool = os.environ.get('NM', 'arm-none-eabi-nm')
+    try:
+        output = subprocess.run([tool, '-n', '--defined-only', elf], check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit('%s failed: %s' % (tool, error))
+    functions = {}
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[1] in 'tTwW':
+            # Thumb function symbols have bit 0 set
+            functions.setdefault(int(fields[0], 16) & ~1, fields[2])
+    return functions
+
+
+def fold(base, records, functions):
+    stacks = {}
+    stack = []
+    pending = 0
+    for record in records:
+        if not record & (FUNCTION_MASK | ENTRY):
+            pending += (record >> DELTA_SHIFT) << LONG_DELTA_SHIFT
+            continue
+        delta = (record >> DELTA_SHIFT) + pending
+        pending = 0
+        if stack:
+            key = ';'.join(stack)
+            stacks[key] = stacks.get(key, 0) + delta
+        address = base + (record & FUNCTION_MASK)
+        name = functions.get(address, '0x%08X' % address)
+        if record & ENTRY:
+            stack.append(name)
+        elif name in stack:
+            # Unwind functions left without an exit record (longjmp, lost records)
+            del stack[len(stack) - 1 - stack[::-1].index(name):]
+    return stacks
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        sys.exit(__doc__.strip().splitlines()[2])
+    base, records = read_trace(sys.argv[2])
+    stacks = fold(base, records, read_functions(sys.argv[1]))
+    lines = ['%s %d\n' % (key, cycles) for key, cycles in sorted(stacks.items()) if cycles]
+    if len(sys.argv) == 4:
+        with open(sys.argv[3], 'w') as f:
+            f.writelines(lines)
+    else:
+        sys.stdout.writelines(lines)
+
+
+if __name__ == '__main__':
+    main()